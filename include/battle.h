@@ -621,6 +621,112 @@ struct ZMoveData
 	bool8 viewingDetails : 1; //Not actually related to Z-Moves, I just felt like putting it here
 };
 
+#define ABILITY_POP_UP_TILES_SIZE (64 * 64 / 2)
+
+struct AbilityPopUpCache
+{
+	const struct Pokemon* nameMon[MAX_BATTLERS_COUNT]; //The party data the name was printed from (Illusion aware)
+	u32 personality[MAX_BATTLERS_COUNT];
+	u8 ability[MAX_BATTLERS_COUNT];
+	u8* tiles[MAX_BATTLERS_COUNT]; //Fully rendered pop-up sprite sheet, kept until the battler switches out
+};
+
+struct BattlerAttributeCache
+{
+	u32 key[3]; //The battler's raw data the attributes were derived from
+	u32 typeMask; //gBitTable[type] for each non-blank type
+	u8 itemEffect;
+	u8 grounding;
+	bool8 valid;
+};
+
+struct BattlerNameCache
+{
+	const struct Pokemon* mon; //Party mon the name was copied from (the disguise if Illusion is up)
+	u8 name[POKEMON_NAME_LENGTH + 1];
+};
+
+#define NUM_ABILITY_CANDIDATES 3 //Ability 1, Ability 2, Hidden Ability
+
+struct AbilityKnowledge //What the other side can tell about a battler's ability
+{
+	u16 species; //Visible species the candidates were taken from
+	u8 candidates[NUM_ABILITY_CANDIDATES]; //Abilities the species can have, ABILITY_NONE in unused slots
+	u8 revealed; //Ability shown in battle, ABILITY_NONE if still unknown
+	u8 lastAbility; //Actual ability when last checked, to notice it being changed
+	bool8 speciesAbilityLost; //Ability was replaced (eg. Skill Swap) so the species says nothing about it
+	bool8 heldItemWorked; //A held item took effect, so the ability isn't Klutz
+};
+
+struct HazardDamageCache
+{
+	u32 hazardKey; //The side's entry hazards the damage was calculated for
+	u32 monKey[PARTY_SIZE][3]; //The party data the damage was calculated from
+	u16 damage[PARTY_SIZE]; //Total damage the party mon would take from the hazards
+	u8 validSlots;
+};
+
+#define NUM_MOVE_LIMITATIONS 8
+
+struct UsableMoveCache
+{
+	u8 movesByLimitation[NUM_MOVE_LIMITATIONS]; //Bits of the moves blocked by each MOVE_LIMITATION_* check
+	u8 alwaysUnusable; //Bits of the moves blocked regardless of the checks requested
+	bool8 valid;
+};
+
+#define NUM_TRIGGER_PALETTES 3 //Mega/Ultra, Z-Move, Dynamax
+#define NUM_TRIGGER_PALETTE_VARIANTS 3 //Light up, normal, grayscale
+
+struct IndicatorBankState
+{
+	struct Sprite* healthbox;
+	u16 healthboxOamX;
+	s16 healthboxY; //pos1.y + pos2.y
+	bool8 healthboxOnScreen;
+	u8 moveMenuState;
+	u8 levelDigits;
+	bool8 holdsMegaStoneOrZCrystal;
+	bool8 megaEvoChecked; //megaEvo and ultraEvo are only filled in when a trigger asks for them
+	bool8 ultraEvoChecked;
+	const struct Evolution* megaEvo;
+	const struct Evolution* ultraEvo;
+};
+
+struct IndicatorState
+{
+	u32 frame; //gMain.vblankCounter2 when the bank states were last built
+	bool8 built;
+	bool8 triggerPalettesReady;
+	s16 triggerXShift;
+	s16 triggerYShift;
+	struct IndicatorBankState bank[MAX_BATTLERS_COUNT];
+	u16 triggerPalettes[NUM_TRIGGER_PALETTES][NUM_TRIGGER_PALETTE_VARIANTS][16];
+};
+
+#define ANIM_SHEET_CACHE_ENTRIES 8
+#define ANIM_SHEET_CACHE_BUDGET 0x2000 //Bytes of decompressed particle gfx, allocated once at the start of the battle
+
+struct AnimSheetCacheEntry
+{
+	u16 tag; //0 if the entry is empty
+	u16 size; //Size given in gBattleAnimPicTable
+	u16 offset; //Into the cache's buffer
+	u16 bufferSize; //Decompressed size rounded up to a word
+	u32 lastUsed;
+};
+
+struct AnimSheetCache
+{
+	struct AnimSheetCacheEntry entries[ANIM_SHEET_CACHE_ENTRIES];
+	u32 clock;
+	u16 usedBytes; //Sheets are packed from the start of the buffer
+	u16 hits;
+	u16 misses;
+	u16 prefetches;
+	u8 buffer[ANIM_SHEET_CACHE_BUDGET] __attribute__((aligned(4)));
+};
+
 #define MAX_NUM_RAID_SHIELDS 5
 
 struct DynamaxData
@@ -917,6 +1023,7 @@ struct NewBattleStruct
 	u8 abilityPopUpIds[MAX_BATTLERS_COUNT][2];
 	u8 backupSynchronizeBanks[2];
 	u16 failedThrownPokeBall;
+	u16 caughtDexCount; //Plus one, 0 until the dex is first counted
 
 	struct 
 	{
@@ -936,9 +1043,19 @@ struct NewBattleStruct
 		const void* megaPotential[MAX_BATTLERS_COUNT]; //aiMegaPotential[bankAtk] - stores evolution data of attacker
 	} ai;
 
+	struct BattlerAttributeCache attributeCache[MAX_BATTLERS_COUNT];
+	u16 attributeCacheMismatches; //Only counted with DEBUG_BATTLER_ATTRIBUTE_CACHE
+	struct UsableMoveCache usableMoveCache[MAX_BATTLERS_COUNT]; //Only used during action selection
+	struct HazardDamageCache hazardDamageCache[NUM_BATTLE_SIDES];
+	struct AbilityKnowledge abilityKnowledge[MAX_BATTLERS_COUNT];
+	struct BattlerNameCache nameCache[MAX_BATTLERS_COUNT];
+
 	struct MegaData* MegaData;
 	struct UltraData* UltraData;
 	struct ZMoveData* ZMoveData;
+	struct AbilityPopUpCache* abilityPopUpCache;
+	struct IndicatorState* indicatorState;
+	struct AnimSheetCache* animSheetCache;
 	struct DynamaxData dynamaxData;
 };
 
@@ -64,6 +64,8 @@ struct HallofFameMon {
     u16 species;
     u8 lvl;
     u8 nick[POKEMON_NAME_LENGTH];
+    u8 filler;
+    u16 teamId; //Only used on mon[0] - orders the teams in the saved ring
 };
 
 struct HallofFameTeam {
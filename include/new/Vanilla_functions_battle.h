@@ -19,6 +19,7 @@ void __attribute__((long_call)) TurnValuesCleanUp(u8);
 void __attribute__((long_call)) SpecialStatusesClear(void);
 void __attribute__((long_call)) CheckFocusPunch_ClearVarsBeforeTurnStarts(void);
 void __attribute__((long_call)) HandleEndTurn_FinishBattle(void);
+void __attribute__((long_call)) HandleTurnActionSelectionState(void);
 bank_t __attribute__((long_call)) GetBattleBank(u8 caseID);
 void __attribute__((long_call)) PressurePPLose(u8 defender, u8 attacker, u16 move);
 void __attribute__((long_call)) PressurePPLoseOnUsingImprision(u8 bankAtk);
@@ -17,6 +17,7 @@ void TransferAbilityPopUpHelper(void);
 void TransferAbilityPopUpHelperAsTrace(void);
 void TransferAbilityPopUpHelperAsImposter(void);
 void TransferAbilityPopUp(u8 bank, u8 ability);
+void FreeAbilityPopUpCacheTiles(u8 bank);
 
 //Functions Hooked In
 pokemon_t* UpdateNickForIllusion(pokemon_t* mon);
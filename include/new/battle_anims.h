@@ -43,6 +43,9 @@ void SpriteCB_SoulStealingStar(struct Sprite *sprite);
 void SpriteCB_GrowingSuperpower(struct Sprite *sprite);
 void SpriteCB_DracoMeteorRock(struct Sprite *sprite);
 
+void PrefetchMoveAnimSheets(const u16* moves);
+void FreeAnimSheetCache(void);
+
 bool8 IsAnimMoveIonDeluge(void);
 bool8 DoesAnimMoveGetMaxRollout(void);
 bool8 IsAnimMoveBloomDoom(void);
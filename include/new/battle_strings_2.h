@@ -44,12 +44,6 @@
             dstID++;                                                    		\
             toCpy++;                                                    		\
         }                                                               		\
-        GetMonData(GetIllusionPartyData(battlerId), MON_DATA_NICKNAME, text);   \
     }                                                                   		\
-    else                                                                		\
-    {                                                                   		\
-        GetMonData(GetIllusionPartyData(battlerId), MON_DATA_NICKNAME, text);   \
-    }                                                                   		\
-    StringGetEnd10(text);                                               		\
-    toCpy = text;																\
+    toCpy = GetBattlerDisplayName(battlerId, text);								\
 }
@@ -9,6 +9,10 @@
  *		  Mainly focuses on trainer mugshots.
  */
 
+//Exported Functions
+void StartMugshotPreload(void);
+void ClearMugshotPreload(void);
+
 //Functions Hooked In
 bool8 Phase2_Mugshot_Func2(struct Task* task);
 void Mugshots_CreateOpponentPlayerSprites(struct Task* task);
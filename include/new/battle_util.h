@@ -16,9 +16,12 @@ ability_t* GetAbilityLocation(u8 bank);
 void RecordAbilityBattle(u8 bank, u8 ability);
 void ClearBattlerAbilityHistory(u8 bank);
 item_effect_t GetBankItemEffect(u8 bank);
+void InvalidateBattlerAttributeCaches(void);
+void InvalidateUsableMoveCaches(void);
 item_effect_t GetMonItemEffect(struct Pokemon* mon);
 item_effect_t GetRecordedItemEffect(u8 bank);
 void RecordItemEffectBattle(u8 bank, u8 itemEffect);
+void RecordItemWorkedBattle(u8 bank);
 void ClearBattlerItemEffectHistory(u8 bank);
 struct Pokemon* GetBankPartyData(u8 bank);
 u16 GetBaseCurrentHP(u8 bank);
@@ -8,6 +8,17 @@
  *		  Navenatox: https://www.pokecommunity.com/showthread.php?p=9030971.
  */
 
+struct PalRefStats
+{
+	u16 loads;			//Palettes written into a slot
+	u16 residentHits;	//Requests served by a palette that was already loaded
+	u16 sharedHits;		//Requests served by a different tag with identical colours
+	u16 evictions;		//Released slots reused for a new palette
+	u16 overflows;		//Requests that found no slot at all
+	u8 slotsInUse;
+	u8 peakSlotsInUse;
+};
+
 //Exported Functions
 u8 AddPalRef(u8 type, u16 palTag);
 u8 FindPalRef(u8 type, u16 palTag);
@@ -21,6 +32,7 @@ u8 FindOrCreateReflectionPalette(u8 palSlotNPC);
 void FogBrightenPalettes(u16 brightenIntensity);
 void FogBrightenAndFade(u8 palSlot, u8 fadeIntensity, u16 fadeColor);
 u8 GetDarkeningTypeBySlot(u8 palSlot);
+const struct PalRefStats* GetPalRefStats(void);
 
 //Hooked In Functions
 u8 PaletteNeedsFogBrightening(u8 palSlot);
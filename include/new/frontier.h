@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../global.h"
+#include "../constants/species.h"
 #include "dynamax.h"
 
 //Exported Functions
@@ -179,33 +180,37 @@ extern const u16 gNumFemaleFrontierTrainerNames;
 extern const u16 gNumTowerTrainers;
 extern const u16 gNumSpecialTowerTrainers;
 
+//Packed into 24 bytes (was 28) since there are thousands of these in ROM.
+//species only has 11 bits, so NUM_SPECIES can't go past 2048 without widening it.
 struct BattleTowerSpread
 {
-    u16 species;
-	u8 nature;
-	u8 ball;
 	u32 hpIv : 5;
 	u32 atkIv : 5;
 	u32 defIv : 5;
 	u32 spdIv : 5;
 	u32 spAtkIv : 5;
 	u32 spDefIv : 5;
+	u32 ability : 2;
+	u16 species : 11;
+	u16 nature : 5;
+	u16 item;
+	u16 moves[MAX_MON_MOVES];
 	u8 hpEv;
 	u8 atkEv;
 	u8 defEv;
 	u8 spdEv;
 	u8 spAtkEv;
 	u8 spDefEv;
-	u16 item;
-	u16 moves[MAX_MON_MOVES];
-	u8 specificTeamType;
+	u8 ball;
+	u8 specificTeamType : 4;
 	u8 shiny : 1;
 	u8 forSingles : 1;
 	u8 forDoubles : 1;
 	u8 modifyMovesDoubles : 1;
-	u8 ability : 2;
 };
 
+_Static_assert(NUM_SPECIES <= 2048, "BattleTowerSpread.species needs more bits");
+
 extern const struct BattleTowerSpread gFrontierSpreads[];
 extern const u16 gNumFrontierSpreads;
 //#define gFrontierSpreads ((const struct BattleTowerSpread*) 0x89DFA00)
@@ -23,6 +23,7 @@ bool8 IsPinchBerryItemEffect(u8 itemEffect);
 bool8 IsGem(u16 item);
 bool8 IsTMHM(u16 item);
 u8 TMIdFromItemId(u16 itemId);
+u16 ItemIdFromTMId(u8 tmId);
 u8 BerryIdFromItemId(u16 item);
 
 u32 CanMonLearnTMHM(struct Pokemon* mon, u8 tm);
@@ -24,6 +24,7 @@ void TrainerFaceFix(void);
 void FollowerPositionFix(u8 offset);
 bool8 IsAutoRunEnabled(void);
 bool8 IsRunningDisallowed(u8 tile);
+u8 GetCurrentAreaEnvironment(void);
 bool8 IsCurrentAreaVolcano(void);
 bool8 IsCurrentAreaAutumn(void);
 bool8 IsCurrentAreaWinter(void);
@@ -55,6 +56,12 @@ bool8 UpdateRepelCounter(void);
 const u8* GetInteractedWaterScript(u32 unused1, u8 metatileBehavior, u8 direction);
 
 //Exported Constants
+#define MAPSEC_ENV_VOLCANO		(1 << 0)
+#define MAPSEC_ENV_AUTUMN		(1 << 1)
+#define MAPSEC_ENV_WINTER		(1 << 2)
+#define MAPSEC_ENV_DARKER_CAVE	(1 << 3)
+#define MAPSEC_ENV_TANOBY_RUINS	(1 << 4)
+
 enum
 {
 	SHOULDNT_BE_SURFING = 1,
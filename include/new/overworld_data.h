@@ -49,3 +49,31 @@ extern const u8 EventScript_UseWaterfall[];
 extern const u8 EventScript_WallOfWater[];
 extern const u8 EventScript_UseRockClimb[];
 extern const u8 EventScript_JustRockWall[];
+
+//Environment classes of each map section - add new areas here instead of to the IsCurrentArea functions
+static const u8 sMapSecEnvironments[MAPSEC_NONE + 1] =
+{
+#ifdef UNBOUND
+	[MAPSEC_CINDER_VOLCANO] = MAPSEC_ENV_VOLCANO,
+
+	[MAPSEC_TEHL_TOWN] = MAPSEC_ENV_AUTUMN,
+	[MAPSEC_ROUTE_9] = MAPSEC_ENV_AUTUMN,
+	[MAPSEC_ROUTE_10] = MAPSEC_ENV_AUTUMN,
+	[MAPSEC_AUBURN_WATERWAY] = MAPSEC_ENV_AUTUMN,
+
+	[MAPSEC_FROZEN_HEIGHTS] = MAPSEC_ENV_WINTER,
+	[MAPSEC_ROUTE_1] = MAPSEC_ENV_WINTER,
+	[MAPSEC_BELLIN_TOWN] = MAPSEC_ENV_WINTER,
+	[MAPSEC_ROUTE_8] = MAPSEC_ENV_WINTER,
+	[MAPSEC_BLIZZARD_CITY] = MAPSEC_ENV_WINTER,
+	[MAPSEC_FROZEN_FOREST] = MAPSEC_ENV_WINTER,
+
+	[MAPSEC_ICICLE_CAVE] = MAPSEC_ENV_DARKER_CAVE,
+	[MAPSEC_VALLEY_CAVE] = MAPSEC_ENV_DARKER_CAVE,
+	[MAPSEC_FROST_MOUNTAIN] = MAPSEC_ENV_DARKER_CAVE,
+	[MAPSEC_THUNDERCAP_MOUNTAIN] = MAPSEC_ENV_DARKER_CAVE,
+	[MAPSEC_DISTORTION_WORLD] = MAPSEC_ENV_DARKER_CAVE,
+#endif
+
+	[MAPSEC_MONEAN_CHAMBER ... MAPSEC_VIAPOIS_CHAMBER] = MAPSEC_ENV_TANOBY_RUINS,
+};
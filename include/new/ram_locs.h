@@ -174,6 +174,12 @@ struct Clock
 
 // Dynamic Overworld Palettes
 //#define sPalRefs ((PalRef*) 0x203B7D4)	// 16 sprites * 4 bytes each = 0x40 bytes
+//#define sPalRefCache ((struct PalRefCache*) 0x203F000) // 0x70 bytes
+
+//#define gInputRecorder ((struct InputRecorder*) 0x203F070) // 0x1C bytes
+//#define sTMItemIndex ((struct TMItemIndex*) 0x203F08C) // 4 + 2 bytes per TM/HM (0x78 bytes by default, up to 0x202)
+//#define sRandomizedAbilityCache ((struct RandomizedAbilityCache*) 0x203F290) // 0x88 bytes
+//#define sMugshotPreload ((struct MugshotPreload*) 0x203F318) // 0x28 bytes
 
 #define gPlayerCoins (*((u32*) 0x203B814))
 //#define gFollowerState ((struct Follower*) 0x203B818) //Approximately ~20 bytes, use 24 to be safe
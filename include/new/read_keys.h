@@ -8,6 +8,11 @@
  *		  used to set up a script to launch when the user presses certain keys.
  */
 
+//Exported Functions
+void StartInputRecording(void);
+void StartInputReplay(void);
+void StopInputRecording(void);
+
 //Functions Hooked In
 void ReadKeys(void);
 
@@ -24,3 +29,36 @@ struct KeypadSetter
 };
 
 #define gKeypadSetter ((struct KeypadSetter*) 0x203B7B0)
+
+enum InputRecordingModes
+{
+	INPUT_RECORDING_OFF,
+	INPUT_RECORDING_RECORD,
+	INPUT_RECORDING_REPLAY,
+};
+
+#define MAX_INPUT_RECORDING_ENTRIES 0x800
+
+//Key state run-length encoded: keys is the raw KEYINPUT value held for numFrames reads
+struct InputRecordingEntry
+{
+	u16 keys;
+	u16 numFrames;
+};
+
+//Read by an emulator (or a debugger) to pull the log off the device
+struct InputRecorder
+{
+	u8 mode;
+	bool8 overflowed; //The log filled up before recording stopped
+	u16 numEntries;
+	u32 seed; //gRngValue when recording started
+	u32 frames; //ReadKeys calls since recording/replay started
+	u32 lagFrames; //VBlanks missed by the main loop since recording/replay started
+	u32 lastVBlank;
+	u16 replayIndex;
+	u16 replayFrame;
+	struct InputRecordingEntry* log;
+};
+
+#define gInputRecorder ((struct InputRecorder*) 0x203F070)
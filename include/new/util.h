@@ -9,6 +9,13 @@
  *		  help in the overworld.
  */
 
+struct CompressedStringReader
+{
+	const u8* src;
+	const u8* entry; //Dictionary entry currently being expanded
+	const u8* const* dictionary;
+};
+
 //Exported Functions
 u32 MathMax(u32 num1, u32 num2);
 u32 MathMin(u32 num1, u32 num2);
@@ -35,3 +42,7 @@ bool8 CanPartyMonBePoisoned(struct Pokemon* mon);
 bool8 CanPartyMonBeParalyzed(struct Pokemon* mon);
 bool8 CanPartyMonBeBurned(struct Pokemon* mon);
 bool8 CanPartyMonBeFrozen(struct Pokemon* mon);
+bool8 IsCompressedString(const u8* str);
+void InitCompressedStringReader(struct CompressedStringReader* reader, const u8* src, const u8* const* dictionary);
+u8 ReadCompressedStringChar(struct CompressedStringReader* reader);
+u8* DecompressStringCopy(u8* dst, const u8* src, const u8* const* dictionary);
@@ -2,6 +2,7 @@
 # -*- coding: cp437 -*-
 
 import sys
+from collections import Counter
 from insert import TryProcessFileInclusion, TryProcessConditionalCompilation
 
 CharMap = "charmap.tbl"
@@ -70,16 +71,31 @@ SpecialBuffers = {
     "DPAD": ["F8", "0C"],
 }
 
+# Compressed strings start with ESCAPE HEADER. After that, a byte from one of the short token
+# ranges (unused by the charmap) expands to one of the most used dictionary entries, ESCAPE
+# followed by an index expands to one of the remaining entries, and ESCAPE LITERAL x is a
+# plain x for the rare string that really contains a token byte.
+COMPRESSION_ESCAPE = 0xF7
+COMPRESSION_HEADER = 0xFE
+COMPRESSION_LITERAL = 0xFF
+SHORT_TOKENS = list(range(0x37, 0x50 + 1)) + list(range(0x87, 0x9F + 1))
+MAX_DICTIONARY_ENTRIES = len(SHORT_TOKENS) + 0xFE
+MIN_ENTRY_LENGTH = 3
+MAX_ENTRY_LENGTH = 16
+ENTRIES_PICKED_PER_PASS = 16
+
 
 def StringFileConverter(fileName: str):
     stringToWrite = ".thumb\n.text\n.align 2\n\n"
     with open(fileName, 'r', encoding="utf-8") as file:
         maxLength = 0
         fillFF = False
+        dictionaryName = ""
         readingState = 0
         lineNum = 0
         definesDict = {}
         conditionals = []
+        entries = []  # [title or None, bytes or None]
 
         for line in file:
             lineNum += 1
@@ -95,7 +111,7 @@ def StringFileConverter(fileName: str):
                 line = line.strip()
                 if line[:6].upper() == "#ORG @" and line[6:] != "":
                     title = line[6:]
-                    stringToWrite += ".global " + title + "\n" + title + ":\n"
+                    entries.append([title, None])
                     readingState = 1
                 elif "MAX_LENGTH" in line and "=" in line:
                     try:
@@ -109,6 +125,8 @@ def StringFileConverter(fileName: str):
                     except:
                         print('Error reading FF fill on line ' + str(lineNum) + ' in file: "' + fileName + '"')
                         sys.exit(0)
+                elif "COMPRESS" in line and "=" in line:
+                    dictionaryName = line.split("=")[1].strip()
                 else:
                     print('Warning! Error on line ' + str(lineNum) + ' in file: "' + fileName + '"')
                     
@@ -116,19 +134,154 @@ def StringFileConverter(fileName: str):
                 if line[:6].upper() == "#ORG @" and line[6:] != "":
                     line = line.strip()
                     title = line[6:]
-                    stringToWrite += ".global " + title + "\n" + title + ":\n"
+                    entries.append([title, None])
                 else:
-                    stringToWrite += ProcessString(line, lineNum, maxLength, fillFF)
-                    stringToWrite += "0xFF\n\n"  # Only print line in everything went alright
+                    entries.append([None, StringToBytes(line, lineNum, maxLength, fillFF)])
+
+    if dictionaryName != "":
+        if fillFF:
+            print('Error: FILL_FF can\'t be used with COMPRESS in file: "' + fileName + '"')
+            sys.exit(1)
+
+        strings = [string for title, string in entries if string is not None]
+        dictionary = OrderDictionaryByUse(BuildDictionary(strings), strings)
+        stringToWrite += DictionaryToAssembly(dictionaryName, dictionary)
+        tokens = DictionaryTokens(dictionary)
+
+    for title, string in entries:
+        if title is not None:
+            stringToWrite += ".global " + title + "\n" + title + ":\n"
+        else:
+            if dictionaryName != "":
+                string = CompressString(string, tokens)
+            stringToWrite += BytesToAssembly(string)
+            stringToWrite += "0xFF\n\n"  # Only print line in everything went alright
 
     output = open(fileName.split(".string")[0] + '.s', 'w')  # Only open file once we know everything went okay.
     output.write(stringToWrite)
     output.close()
 
 
-def ProcessString(string: str, lineNum: int, maxLength=0, fillWithFF=False) -> str:
+def BytesToAssembly(string: [int]) -> str:
+    return ".byte " + "".join(hex(char) + ", " for char in string)
+
+
+def DictionaryToAssembly(dictionaryName: str, dictionary: [bytes]) -> str:
+    stringToWrite = ".global " + dictionaryName + "\n" + dictionaryName + ":\n"
+    for i in range(len(dictionary)):
+        stringToWrite += ".word " + dictionaryName + "_" + str(i) + "\n"
+
+    stringToWrite += "\n"
+    for i, entry in enumerate(dictionary):
+        stringToWrite += dictionaryName + "_" + str(i) + ":\n"
+        stringToWrite += BytesToAssembly(list(entry)) + "0xFF\n"
+
+    return stringToWrite + "\n"
+
+
+def SplitOnEntries(segment: bytes, entries: [bytes]) -> [bytes]:
+    # Remove every occurrence of the new entries, leaving the runs still left uncompressed
+    for entry in entries:
+        if entry in segment:
+            return [piece for part in segment.split(entry) for piece in SplitOnEntries(part, entries)]
+
+    return [segment] if len(segment) >= MIN_ENTRY_LENGTH else []
+
+
+def BuildDictionary(strings: [[int]]) -> [bytes]:
+    dictionary = []
+    segments = []
+    for string in strings:  # Literal escapes are never part of an entry
+        segments += [part for part in bytes(string).split(bytes([COMPRESSION_ESCAPE])) if len(part) >= MIN_ENTRY_LENGTH]
+
+    while len(dictionary) < MAX_DICTIONARY_ENTRIES:
+        counts = Counter()
+        for segment in segments:
+            for length in range(MIN_ENTRY_LENGTH, min(MAX_ENTRY_LENGTH, len(segment)) + 1):
+                for i in range(len(segment) - length + 1):
+                    counts[segment[i:i + length]] += 1
+
+        # Each use saves the entry length minus the two byte token, and the entry costs its bytes,
+        # its terminator, and its pointer
+        candidates = sorted(((len(entry) - 2) * count - (len(entry) + 5), entry) for entry, count in counts.items())
+        picked = []
+        while candidates and len(picked) < ENTRIES_PICKED_PER_PASS \
+                and len(dictionary) + len(picked) < MAX_DICTIONARY_ENTRIES:
+            savings, entry = candidates.pop()
+            if savings <= 0:
+                break
+            if any(entry in other or other in entry for other in picked):  # Counts would overlap
+                continue
+            picked.append(entry)
+
+        if not picked:
+            break
+
+        picked.sort(key=len, reverse=True)
+        dictionary += picked
+        segments = [piece for segment in segments for piece in SplitOnEntries(segment, picked)]
+
+    return dictionary
+
+
+def DictionaryTokens(dictionary: [bytes]) -> {bytes: [int]}:
+    tokens = {}
+    for i, entry in enumerate(dictionary):
+        if i < len(SHORT_TOKENS):
+            tokens[entry] = [SHORT_TOKENS[i]]
+        else:
+            tokens[entry] = [COMPRESSION_ESCAPE, i - len(SHORT_TOKENS)]
+
+    return tokens
+
+
+def TokenizeString(string: [int], tokens: {bytes: [int]}) -> [bytes or int]:
+    # Greedy longest match, entries come out as bytes and everything else as ints
+    raw = bytes(string)
+    pieces = []
+    i = 0
+
+    while i < len(raw):
+        for length in range(min(MAX_ENTRY_LENGTH, len(raw) - i), MIN_ENTRY_LENGTH - 1, -1):
+            entry = raw[i:i + length]
+            if entry in tokens:
+                pieces.append(entry)
+                i += length
+                break
+        else:
+            pieces.append(raw[i])
+            i += 1
+
+    return pieces
+
+
+def OrderDictionaryByUse(dictionary: [bytes], strings: [[int]]) -> [bytes]:
+    # The entries used the most get the one byte tokens
+    uses = Counter()
+    tokens = {entry: None for entry in dictionary}
+    for string in strings:
+        uses.update(piece for piece in TokenizeString(string, tokens) if isinstance(piece, bytes))
+
+    return sorted(dictionary, key=lambda entry: (len(entry) - 1) * uses[entry], reverse=True)
+
+
+def CompressString(string: [int], tokens: {bytes: [int]}) -> [int]:
+    compressed = [COMPRESSION_ESCAPE, COMPRESSION_HEADER]
+
+    for piece in TokenizeString(string, tokens):
+        if isinstance(piece, bytes):
+            compressed += tokens[piece]
+        elif piece == COMPRESSION_ESCAPE or piece in SHORT_TOKENS:
+            compressed += [COMPRESSION_ESCAPE, COMPRESSION_LITERAL, piece]
+        else:
+            compressed.append(piece)
+
+    return compressed
+
+
+def StringToBytes(string: str, lineNum: int, maxLength=0, fillWithFF=False) -> [int]:
     charMap = PokeByteTableMaker()
-    stringToWrite = ".byte "
+    stringBytes = []
     buffer = False
     escapeChar = False
     bufferChars = ""
@@ -151,15 +304,15 @@ def ProcessString(string: str, lineNum: int, maxLength=0, fillWithFF=False) -> s
                                   + str(maxLength) + ' and has been truncated!')
                             break
 
-                        stringToWrite += ("0x" + bufferChar + ", ")
+                        stringBytes.append(int(bufferChar, 16))
                         strLen += 1
 
                 elif len(bufferChars) > 2:  # Unrecognized buffer
                     print('Warning: The string buffer "' + bufferChars + '" is not recognized!')
-                    stringToWrite += "0x0, "  # Place whitespace where the buffer should have gone
+                    stringBytes.append(0)  # Place whitespace where the buffer should have gone
                     strLen += 1
                 else:
-                    stringToWrite += ("0x" + bufferChars + ", ")
+                    stringBytes.append(int(bufferChars, 16))
                     strLen += 1
 
                 bufferChars = ""
@@ -169,7 +322,7 @@ def ProcessString(string: str, lineNum: int, maxLength=0, fillWithFF=False) -> s
         elif escapeChar is True:
             escapeChar = False
             try:
-                stringToWrite += hex(charMap["\\" + char]) + ", "
+                stringBytes.append(charMap["\\" + char])
                 strLen += 1
 
             except KeyError:
@@ -178,7 +331,7 @@ def ProcessString(string: str, lineNum: int, maxLength=0, fillWithFF=False) -> s
 
         else:
             try:
-                stringToWrite += hex(charMap[char]) + ", "
+                stringBytes.append(charMap[char])
                 strLen += 1
 
             except KeyError:
@@ -187,7 +340,7 @@ def ProcessString(string: str, lineNum: int, maxLength=0, fillWithFF=False) -> s
                 elif char == '\\':
                     escapeChar = True
                 elif char == '"':
-                    stringToWrite += hex(charMap["\\" + char])
+                    stringBytes.append(charMap["\\" + char])
                     strLen += 1
                 else:
                     print('Error parsing string on line ' + str(lineNum) + ' at character "' + char + '".')
@@ -195,10 +348,10 @@ def ProcessString(string: str, lineNum: int, maxLength=0, fillWithFF=False) -> s
     
     if strLen < maxLength and fillWithFF:
         while strLen < maxLength:
-            stringToWrite += "0xFF, "
+            stringBytes.append(0xFF)
             strLen += 1
 
-    return stringToWrite
+    return stringBytes
 
 
 def PokeByteTableMaker():
@@ -902,7 +902,7 @@ u16 GetStrongestMove(const u8 bankAtk, const u8 bankDef)
 bool8 MoveWillHit(u16 move, u8 bankAtk, u8 bankDef)
 {
 	#ifdef REALLY_SMART_AI
-		u8 defAbility = BATTLE_HISTORY->abilities[bankDef];
+		u8 defAbility = GetRecordedAbility(bankDef);
 	#else
 		u8 defAbility = ABILITY(bankDef);
 	#endif
@@ -1029,16 +1029,7 @@ bool8 WillTakeSignificantDamageFromEntryHazards(u8 bank, u8 healthFraction)
 	&& GetMonAbility(GetBankPartyData(bank)) != ABILITY_MAGICGUARD
 	&& ITEM_EFFECT(bank) != ITEM_EFFECT_HEAVY_DUTY_BOOTS)
 	{
-		struct Pokemon* mon = GetBankPartyData(bank);
-
-		if (gSideTimers[SIDE(bank)].srAmount > 0)
-			dmg += CalcStealthRockDamagePartyMon(mon);
-			
-		if (gSideTimers[SIDE(bank)].steelsurge > 0)
-			dmg += CalcSteelsurgeDamagePartyMon(mon);
-
-		if (gSideTimers[SIDE(bank)].spikesAmount > 0)
-			dmg += CalcSpikesDamagePartyMon(mon, SIDE(bank));
+		dmg = GetEntryHazardDamagePartyMon(GetBankPartyData(bank), SIDE(bank));
 
 		if (dmg >= gBattleMons[bank].hp)
 			return TRUE;
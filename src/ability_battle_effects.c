@@ -395,6 +395,7 @@ extern u8 CastformDataTypeChange(u8 bank);
 extern void TransformPokemon(u8 bankAtk, u8 bankDef);
 
 //This file's functions:
+static u8 AbilityPresenceQuery(u8 caseID, u8 bank, u8 ability);
 static u8 CalcMovePowerForForewarn(u16 move);
 static u8 ActivateWeatherAbility(u16 flags, u16 item, u8 bank, u8 animArg, u8 stringIndex, bool8 moveTurn);
 static u8 TryActivateTerrainAbility(u8 terrain, u8 anim, u8 bank);
@@ -417,6 +418,22 @@ u8 AbilityBattleEffects(u8 caseID, u8 bank, u8 ability, u8 special, u16 moveArg)
 	if (gBattleTypeFlags & (BATTLE_TYPE_SAFARI | BATTLE_TYPE_OLD_MAN))
 		return FALSE;
 
+	if (caseID >= ABILITYEFFECT_CHECK_OTHER_SIDE && caseID <= ABILITYEFFECT_CHECK_ON_FIELD
+	&& caseID != ABILITYEFFECT_FIELD_SPORT
+	#ifndef NO_GHOST_BATTLES
+	&& !IS_GHOST_BATTLE //Ghost battles hide abilities below
+	#endif
+	&& !gNewBS->skipCertainSwitchInAbilities) //The full path below clears this flag
+	{
+		//Plain lookups don't need any of the other setup
+		if (special)
+			gLastUsedAbility = special;
+		else
+			gLastUsedAbility = ABILITY(bank);
+
+		return AbilityPresenceQuery(caseID, bank, ability);
+	}
+
 	if (gBankAttacker >= gBattlersCount)
 		gBankAttacker = bank;
 
@@ -2145,26 +2162,13 @@ u8 AbilityBattleEffects(u8 caseID, u8 bank, u8 ability, u8 special, u16 moveArg)
 			break;
 
 		case ABILITYEFFECT_CHECK_OTHER_SIDE: // 12
-			side = SIDE(bank);
-			for (i = 0; i < gBattlersCount; i++)
-			{
-				if (SIDE(i) != side && ABILITY(i) == ability)
-				{
-					gLastUsedAbility = ability;
-					effect = i + 1;
-				}
-			}
-			break;
 		case ABILITYEFFECT_CHECK_BANK_SIDE: // 13
-			side = SIDE(bank);
-			for (i = 0; i < gBattlersCount; i++)
-			{
-				if (SIDE(i) == side && ABILITY(i) == ability)
-				{
-					gLastUsedAbility = ability;
-					effect = i + 1;
-				}
-			}
+		case ABILITYEFFECT_CHECK_FIELD_EXCEPT_BANK: // 15
+		case ABILITYEFFECT_COUNT_OTHER_SIDE: // 16
+		case ABILITYEFFECT_COUNT_BANK_SIDE: // 17
+		case ABILITYEFFECT_COUNT_ON_FIELD: // 18
+		case ABILITYEFFECT_CHECK_ON_FIELD: // 19
+			effect = AbilityPresenceQuery(caseID, bank, ability);
 			break;
 		case ABILITYEFFECT_FIELD_SPORT: // 14
 			switch (gLastUsedAbility) {
@@ -2186,58 +2190,6 @@ u8 AbilityBattleEffects(u8 caseID, u8 bank, u8 ability, u8 special, u16 moveArg)
 					break;
 			}
 			break;
-		case ABILITYEFFECT_CHECK_ON_FIELD: // 19
-			for (i = 0; i < gBattlersCount; i++)
-			{
-				if (ABILITY(i) == ability && gBattleMons[i].hp)
-				{
-					gLastUsedAbility = ability;
-					effect = i + 1;
-				}
-			}
-			break;
-		case ABILITYEFFECT_CHECK_FIELD_EXCEPT_BANK: // 15
-			for (i = 0; i < gBattlersCount; i++)
-			{
-				if (ABILITY(i) == ability && i != bank)
-				{
-					gLastUsedAbility = ability;
-					effect = i + 1;
-				}
-			}
-			break;
-		case ABILITYEFFECT_COUNT_OTHER_SIDE: // 16
-			side = SIDE(bank);
-			for (i = 0; i < gBattlersCount; i++)
-			{
-				if (SIDE(i) != side && ABILITY(i) == ability)
-				{
-					gLastUsedAbility = ability;
-					effect++;
-				}
-			}
-			break;
-		case ABILITYEFFECT_COUNT_BANK_SIDE: // 17
-			side = SIDE(bank);
-			for (i = 0; i < gBattlersCount; i++)
-			{
-				if (SIDE(i) == side && ABILITY(i) == ability)
-				{
-					gLastUsedAbility = ability;
-					effect++;
-				}
-			}
-			break;
-		case ABILITYEFFECT_COUNT_ON_FIELD: // 18
-			for (i = 0; i < gBattlersCount; i++)
-			{
-				if (ABILITY(i) == ability && i != bank)
-				{
-					gLastUsedAbility = ability;
-					effect++;
-				}
-			}
-			break;
 		}
 
 	if (effect && caseID < ABILITYEFFECT_CHECK_OTHER_SIDE && gLastUsedAbility != 0xFF)
@@ -2246,6 +2198,59 @@ u8 AbilityBattleEffects(u8 caseID, u8 bank, u8 ability, u8 special, u16 moveArg)
 	return effect;
 }
 
+//Answers the ABILITYEFFECT_CHECK_* and ABILITYEFFECT_COUNT_* queries
+static u8 AbilityPresenceQuery(u8 caseID, u8 bank, u8 ability)
+{
+	s32 i;
+	u8 count = 0;
+	u8 side = SIDE(bank);
+
+	//The checks return the last matching bank, so search from the back and stop at the first one
+	bool8 stopAtFirst = caseID != ABILITYEFFECT_COUNT_OTHER_SIDE
+					 && caseID != ABILITYEFFECT_COUNT_BANK_SIDE
+					 && caseID != ABILITYEFFECT_COUNT_ON_FIELD;
+
+	for (i = gBattlersCount - 1; i >= 0; --i)
+	{
+		switch (caseID) {
+			case ABILITYEFFECT_CHECK_OTHER_SIDE:
+			case ABILITYEFFECT_COUNT_OTHER_SIDE:
+				if (SIDE(i) == side)
+					continue;
+				break;
+			case ABILITYEFFECT_CHECK_BANK_SIDE:
+			case ABILITYEFFECT_COUNT_BANK_SIDE:
+				if (SIDE(i) != side)
+					continue;
+				break;
+			case ABILITYEFFECT_CHECK_FIELD_EXCEPT_BANK:
+			case ABILITYEFFECT_COUNT_ON_FIELD:
+				if (i == bank)
+					continue;
+				break;
+			case ABILITYEFFECT_CHECK_ON_FIELD:
+				if (gBattleMons[i].hp == 0)
+					continue;
+				break;
+		}
+
+		if (gBattleMons[i].ability != ability && ability != ABILITY_NONE) //Skip the suppression check for most banks
+			continue;
+
+		if (ABILITY(i) == ability)
+		{
+			gLastUsedAbility = ability;
+
+			if (stopAtFirst)
+				return i + 1;
+
+			++count;
+		}
+	}
+
+	return count;
+}
+
 static u8 CalcMovePowerForForewarn(u16 move)
 {
 	u8 power;
@@ -2451,6 +2456,9 @@ species_t TryUpdateIllusionAltitude(u8 bank)
 #define tSpriteId1	  data[6]
 #define tSpriteId2	  data[7]
 
+//Each battler gets its own tiles so pop-ups on screen at the same time don't share text
+#define ABILITY_POP_UP_TILE_TAG(bank) (0xD720 + (bank))
+
 extern const struct CompressedSpriteSheet gBattleAnimPicTable[];
 extern const struct CompressedSpritePalette gBattleAnimPaletteTable[];
 extern const u8 Ability_Pop_UpTiles[64 * 64 / 2];
@@ -2568,6 +2576,7 @@ static void TextIntoAbilityPopUp(void *dest, u8 *windowTileData, s32 arg2, bool3
 }
 
 #define MAX_CHARS_PRINTED 12
+#define ABILITY_POP_UP_SPRITE_2_OFFSET (32 * 32) //The second sprite starts on tile 32
 
 static void PrintOnAbilityPopUp(const u8* str, u8* spriteTileData1, u8* spriteTileData2, u32 x1, u32 x2, u32 y, u32 color1, u32 color2, u32 color3)
 {
@@ -2604,7 +2613,7 @@ static void PrintOnAbilityPopUp(const u8* str, u8* spriteTileData1, u8* spriteTi
 	}
 }
 
-static void PrintBattlerOnAbilityPopUp(u8 battlerId, u8 spriteId1, u8 spriteId2)
+static void PrintBattlerOnAbilityPopUp(u8 battlerId, u8* tiles)
 {
 	int i;
 	u8 lastChar;
@@ -2638,20 +2647,20 @@ static void PrintBattlerOnAbilityPopUp(u8 battlerId, u8 spriteId1, u8 spriteId2)
 	textPtr[0] = EOS;
 
 	PrintOnAbilityPopUp((const u8*) monName,
-						(void*)(OBJ_VRAM0) + (gSprites[spriteId1].oam.tileNum * 32),
-						(void*)(OBJ_VRAM0) + (gSprites[spriteId2].oam.tileNum * 32),
+						tiles,
+						tiles + ABILITY_POP_UP_SPRITE_2_OFFSET,
 						5, 0,
 						0,
 						2, 7, 1);
 }
 
-static void PrintAbilityOnAbilityPopUp(u32 ability, u8 spriteId1, u8 spriteId2)
+static void PrintAbilityOnAbilityPopUp(u32 ability, u8* tiles)
 {
 	const u8* abilityName = GetAbilityName(ability);
 
 	PrintOnAbilityPopUp(abilityName,
-						(void*)(OBJ_VRAM0) + (gSprites[spriteId1].oam.tileNum * 32) + 256,
-						(void*)(OBJ_VRAM0) + (gSprites[spriteId2].oam.tileNum * 32) + 256,
+						tiles + 256,
+						tiles + ABILITY_POP_UP_SPRITE_2_OFFSET + 256,
 						5, 1,
 						4,
 						7, 9, 1);
@@ -2758,19 +2767,50 @@ static inline void CopyPixels(u8 *dest, const u8 *src, u32 pixelCount)
 static void RestoreOverwrittenPixels(u8 *tiles)
 {
 	u32 i;
-	u8 *buffer = Malloc(sizeof(Ability_Pop_UpTiles) * 2);
-
-	CpuCopy32(tiles, buffer, sizeof(Ability_Pop_UpTiles));
 
+	//The tiles are in RAM so they can be fixed up in place
 	for (i = 0; i < ARRAY_COUNT(sOverwrittenPixelsTable); i++)
 	{
-		CopyPixels(buffer + sOverwrittenPixelsTable[i][0],
+		CopyPixels(tiles + sOverwrittenPixelsTable[i][0],
 				   Ability_Pop_UpTiles + sOverwrittenPixelsTable[i][0],
 				   sOverwrittenPixelsTable[i][1]);
 	}
+}
+
+static const u8* GetRenderedAbilityPopUpTiles(u8 bank, u8 ability)
+{
+	struct AbilityPopUpCache* cache = gNewBS->abilityPopUpCache;
+	const struct Pokemon* mon = GetIllusionPartyData(bank);
+	u8* tiles = cache->tiles[bank];
+
+	if (tiles == NULL
+	|| cache->ability[bank] != ability
+	|| cache->nameMon[bank] != mon
+	|| cache->personality[bank] != mon->personality) //Different mon switched in, Illusion broke, or ability changed
+	{
+		if (tiles == NULL)
+			tiles = cache->tiles[bank] = Malloc(ABILITY_POP_UP_TILES_SIZE);
+
+		CpuCopy32(Ability_Pop_UpTiles, tiles, ABILITY_POP_UP_TILES_SIZE);
+		PrintBattlerOnAbilityPopUp(bank, tiles);
+		PrintAbilityOnAbilityPopUp(ability, tiles);
+		RestoreOverwrittenPixels(tiles);
 
-	CpuCopy32(buffer, tiles, sizeof(Ability_Pop_UpTiles));
-	Free(buffer);
+		cache->nameMon[bank] = mon;
+		cache->personality[bank] = mon->personality;
+		cache->ability[bank] = ability;
+	}
+
+	return tiles;
+}
+
+//The tiles are kept until the battler switches out or the battle ends, so back to back pop-ups don't render again
+void FreeAbilityPopUpCacheTiles(u8 bank)
+{
+	struct AbilityPopUpCache* cache = gNewBS->abilityPopUpCache;
+
+	Free(cache->tiles[bank]);
+	cache->tiles[bank] = NULL;
 }
 
 void AnimTask_LoadAbilityPopUp(u8 taskId)
@@ -2778,8 +2818,24 @@ void AnimTask_LoadAbilityPopUp(u8 taskId)
 	const s16 (*coords)[2];
 	u8 spriteId1, spriteId2, battlerPosition, destroyerTaskId;
 	u8 ability = gAbilityPopUpHelper; //Preceded by transfer of proper ability
-
-	LoadSpriteSheet((const struct SpriteSheet*) &gBattleAnimPicTable[ANIM_TAG_ABILITY_POP_UP - ANIM_SPRITES_START]);
+	u16 tileTag = ABILITY_POP_UP_TILE_TAG(gBattleAnimAttacker);
+	u16 tileStart = GetSpriteTileStartByTag(tileTag);
+	struct SpriteSheet popUpSheet;
+	struct SpriteTemplate template1 = sSpriteTemplate_AbilityPopUp1;
+	struct SpriteTemplate template2 = sSpriteTemplate_AbilityPopUp2;
+
+	//The text is only rendered the first time a battler shows this ability since switching in, after that it's just a copy to VRAM
+	popUpSheet.data = GetRenderedAbilityPopUpTiles(gBattleAnimAttacker, ability);
+	popUpSheet.size = ABILITY_POP_UP_TILES_SIZE;
+	popUpSheet.tag = tileTag;
+
+	if (tileStart == 0xFFFF)
+		LoadSpriteSheet(&popUpSheet);
+	else //Battler's last pop-up is still sliding out, so reuse its tiles
+		CpuCopy32(popUpSheet.data, (void*)(OBJ_VRAM0) + (tileStart * 32), ABILITY_POP_UP_TILES_SIZE);
+
+	template1.tileTag = tileTag;
+	template2.tileTag = tileTag;
 	LoadSpritePalette((const struct SpritePalette*) &gBattleAnimPaletteTable[ANIM_TAG_ABILITY_POP_UP - ANIM_SPRITES_START]);
 
 	gNewBS->activeAbilityPopUps |= gBitTable[gBattleAnimAttacker];
@@ -2792,10 +2848,10 @@ void AnimTask_LoadAbilityPopUp(u8 taskId)
 
 	if ((battlerPosition & BIT_SIDE) == B_SIDE_PLAYER)
 	{
-		spriteId1 = CreateSprite(&sSpriteTemplate_AbilityPopUp1,
+		spriteId1 = CreateSprite(&template1,
 								coords[battlerPosition][0] - ABILITY_POP_UP_POS_X_SLIDE,
 								coords[battlerPosition][1], 0);
-		spriteId2 = CreateSprite(&sSpriteTemplate_AbilityPopUp2,
+		spriteId2 = CreateSprite(&template2,
 								coords[battlerPosition][0] - ABILITY_POP_UP_POS_X_SLIDE + ABILITY_POP_UP_POS_X_DIFF,
 								coords[battlerPosition][1], 0);
 
@@ -2807,10 +2863,10 @@ void AnimTask_LoadAbilityPopUp(u8 taskId)
 	}
 	else
 	{
-		spriteId1 = CreateSprite(&sSpriteTemplate_AbilityPopUp1,
+		spriteId1 = CreateSprite(&template1,
 								coords[battlerPosition][0] + ABILITY_POP_UP_POS_X_SLIDE,
 								coords[battlerPosition][1], 0);
-		spriteId2 = CreateSprite(&sSpriteTemplate_AbilityPopUp2,
+		spriteId2 = CreateSprite(&template2,
 								coords[battlerPosition][0] + ABILITY_POP_UP_POS_X_SLIDE + ABILITY_POP_UP_POS_X_DIFF,
 								coords[battlerPosition][1], 0);
 
@@ -2827,6 +2883,7 @@ void AnimTask_LoadAbilityPopUp(u8 taskId)
 	destroyerTaskId = CreateTask(Task_FreeAbilityPopUpGfx, 5);
 	gTasks[destroyerTaskId].tSpriteId1 = spriteId1;
 	gTasks[destroyerTaskId].tSpriteId2 = spriteId2;
+	gTasks[destroyerTaskId].tBattlerId = gBattleAnimAttacker;
 
 	gSprites[spriteId1].tIsMain = TRUE;
 	gSprites[spriteId1].tBattlerId = gBattleAnimAttacker;
@@ -2835,10 +2892,6 @@ void AnimTask_LoadAbilityPopUp(u8 taskId)
 	StartSpriteAnim(&gSprites[spriteId1], 0);
 	StartSpriteAnim(&gSprites[spriteId2], 0);
 
-	PrintBattlerOnAbilityPopUp(gBattleAnimAttacker, spriteId1, spriteId2);
-	PrintAbilityOnAbilityPopUp(ability, spriteId1, spriteId2);
-	RestoreOverwrittenPixels((void*)(OBJ_VRAM0) + (gSprites[spriteId1].oam.tileNum * 32));
-
 	DestroyAnimVisualTask(taskId);
 }
 
@@ -2872,16 +2925,19 @@ static void SpriteCb_AbilityPopUp(struct Sprite* sprite)
 
 static void Task_FreeAbilityPopUpGfx(u8 taskId)
 {
+	u8 bank = gTasks[taskId].tBattlerId;
+
 	if (!gSprites[gTasks[taskId].tSpriteId1].inUse
 		&& !gSprites[gTasks[taskId].tSpriteId2].inUse
-		&& !gNewBS->activeAbilityPopUps)
+		&& !(gNewBS->activeAbilityPopUps & gBitTable[bank])) //Battler doesn't have a newer pop-up using the same tiles
 	{
-		u8 bank = gSprites[gTasks[taskId].tSpriteId1].tBattlerId;
-
 		gNewBS->abilityPopUpIds[bank][0] = 0;
 		gNewBS->abilityPopUpIds[bank][1] = 0;
-		FreeSpriteTilesByTag(ANIM_TAG_ABILITY_POP_UP);
-		FreeSpritePaletteByTag(ANIM_TAG_ABILITY_POP_UP);
+		FreeSpriteTilesByTag(ABILITY_POP_UP_TILE_TAG(bank));
+
+		if (!gNewBS->activeAbilityPopUps) //Last pop-up on screen
+			FreeSpritePaletteByTag(ANIM_TAG_ABILITY_POP_UP);
+
 		DestroyTask(taskId);
 	}
 }
@@ -511,6 +511,10 @@ static u8 GetProperCentredCoord(u8 bank, u8 coordType);
 static void Task_HandleSpecialBattleAnimation(u8 taskId);
 static bool8 ShouldAnimBeDoneRegardlessOfSubsitute(u8 animId);
 static bool8 ShouldSubstituteRecedeForSpecialBattleAnim(u8 animId);
+static struct AnimSheetCacheEntry* GetCachedAnimSheet(u16 tag);
+static void EvictAnimSheet(struct AnimSheetCache* cache, struct AnimSheetCacheEntry* evicted);
+static struct AnimSheetCacheEntry* CacheAnimSheet(u16 tag, bool8 canEvict);
+static void LoadAnimSpriteGfx(u16 tag);
 static void TrySwapBackupSpeciesWithSpecies(u8 activeBattler, u8 animId);
 static void AnimTask_GrowStep(u8 taskId);
 static void AnimDracoMeteorRockStep(struct Sprite *sprite);
@@ -547,14 +551,173 @@ bank_t LoadBattleAnimTarget(u8 arg)
 }
 
 #define GET_TRUE_SPRITE_INDEX(i) ((i - ANIM_SPRITES_START))
+#define GET_LZ_DECOMPRESSED_SIZE(src) ((src)[1] | ((src)[2] << 8) | ((src)[3] << 16))
+#define SCRIPT_CMD_LOADSPRITEGFX 0x0
+
+static struct AnimSheetCacheEntry* GetCachedAnimSheet(u16 tag)
+{
+	u32 i;
+	struct AnimSheetCache* cache = gNewBS->animSheetCache;
+
+	for (i = 0; i < ANIM_SHEET_CACHE_ENTRIES; ++i)
+	{
+		if (cache->entries[i].tag == tag)
+			return &cache->entries[i];
+	}
+
+	return NULL;
+}
+
+//Drops a sheet and slides the ones after it down so the free space stays at the end of the buffer
+static void EvictAnimSheet(struct AnimSheetCache* cache, struct AnimSheetCacheEntry* evicted)
+{
+	u32 i;
+	u32 end = evicted->offset + evicted->bufferSize;
+
+	if (end < cache->usedBytes)
+		CpuCopy32(cache->buffer + end, cache->buffer + evicted->offset, cache->usedBytes - end); //Copies forward, so the overlap is fine
+
+	for (i = 0; i < ANIM_SHEET_CACHE_ENTRIES; ++i)
+	{
+		if (cache->entries[i].tag != 0 && cache->entries[i].offset > evicted->offset)
+			cache->entries[i].offset -= evicted->bufferSize;
+	}
+
+	cache->usedBytes -= evicted->bufferSize;
+	evicted->tag = 0;
+}
+
+//Decompresses the particle gfx for the tag into the cache's buffer. When
+//there's no room and eviction is allowed, the least recently used sheets are
+//dropped until it fits.
+static struct AnimSheetCacheEntry* CacheAnimSheet(u16 tag, bool8 canEvict)
+{
+	u32 i, size;
+	struct AnimSheetCacheEntry* entry;
+	struct AnimSheetCache* cache = gNewBS->animSheetCache;
+	const struct CompressedSpriteSheet* sheet = &gBattleAnimPicTable[GET_TRUE_SPRITE_INDEX(tag)];
+
+	size = (GET_LZ_DECOMPRESSED_SIZE(sheet->data) + 3) & ~3;
+	if (size > ANIM_SHEET_CACHE_BUDGET)
+		return NULL;
+
+	for (;;)
+	{
+		entry = NULL;
+		for (i = 0; i < ANIM_SHEET_CACHE_ENTRIES; ++i)
+		{
+			if (cache->entries[i].tag == 0)
+			{
+				entry = &cache->entries[i];
+				break;
+			}
+		}
+
+		if (entry != NULL && cache->usedBytes + size <= ANIM_SHEET_CACHE_BUDGET)
+			break; //Fits
+
+		if (!canEvict)
+			return NULL;
+
+		//Evict the least recently used sheet
+		entry = NULL;
+		for (i = 0; i < ANIM_SHEET_CACHE_ENTRIES; ++i)
+		{
+			if (cache->entries[i].tag != 0
+			&& (entry == NULL || cache->entries[i].lastUsed < entry->lastUsed))
+				entry = &cache->entries[i];
+		}
+
+		EvictAnimSheet(cache, entry);
+	}
+
+	LZ77UnCompWram(sheet->data, cache->buffer + cache->usedBytes);
+	entry->tag = tag;
+	entry->size = sheet->size;
+	entry->offset = cache->usedBytes;
+	entry->bufferSize = size;
+	entry->lastUsed = cache->clock;
+	cache->usedBytes += size;
+	return entry;
+}
+
+static void LoadAnimSpriteGfx(u16 tag)
+{
+	struct AnimSheetCacheEntry* entry = NULL;
+	struct AnimSheetCache* cache = (gNewBS != NULL) ? gNewBS->animSheetCache : NULL;
+
+	if (cache != NULL)
+	{
+		++cache->clock;
+		entry = GetCachedAnimSheet(tag);
+
+		if (entry != NULL)
+		{
+			++cache->hits;
+			entry->lastUsed = cache->clock;
+		}
+		else
+		{
+			++cache->misses;
+			entry = CacheAnimSheet(tag, TRUE);
+		}
+	}
+
+	if (entry != NULL)
+	{
+		struct SpriteSheet sheet = {cache->buffer + entry->offset, entry->size, tag};
+		LoadSpriteSheet(&sheet);
+	}
+	else
+		LoadCompressedSpriteSheetUsingHeap(&gBattleAnimPicTable[GET_TRUE_SPRITE_INDEX(tag)]);
+
+	LoadCompressedSpritePaletteUsingHeap(&gBattleAnimPaletteTable[GET_TRUE_SPRITE_INDEX(tag)]);
+}
+
+//Called every frame the move menu is open. Decompresses at most one sheet the
+//moves' animations start by loading so the first frame of the animation doesn't
+//have to. Never evicts, so the moves can't keep pushing each other's sheets out.
+void PrefetchMoveAnimSheets(const u16* moves)
+{
+	u32 i;
+	const u8* script;
+	struct AnimSheetCache* cache = gNewBS->animSheetCache;
+
+	if (cache == NULL)
+		return;
+
+	for (i = 0; i < MAX_MON_MOVES; ++i)
+	{
+		if (moves[i] == MOVE_NONE || moves[i] >= MOVES_COUNT)
+			continue;
+
+		for (script = gMoveAnimations[moves[i]]; *script == SCRIPT_CMD_LOADSPRITEGFX; script += 3)
+		{
+			u16 tag = T1_READ_16(script + 1);
+
+			if (GetCachedAnimSheet(tag) == NULL)
+			{
+				if (CacheAnimSheet(tag, FALSE) != NULL)
+					++cache->prefetches;
+				return; //One per frame
+			}
+		}
+	}
+}
+
+void FreeAnimSheetCache(void)
+{
+	Free(gNewBS->animSheetCache);
+	gNewBS->animSheetCache = NULL;
+}
+
 void ScriptCmd_loadspritegfx(void)
 {
 	u16 index;
 
 	sBattleAnimScriptPtr++;
 	index = T1_READ_16(sBattleAnimScriptPtr);
-	LoadCompressedSpriteSheetUsingHeap(&gBattleAnimPicTable[GET_TRUE_SPRITE_INDEX(index)]);
-	LoadCompressedSpritePaletteUsingHeap(&gBattleAnimPaletteTable[GET_TRUE_SPRITE_INDEX(index)]);
+	LoadAnimSpriteGfx(index);
 	sBattleAnimScriptPtr += 2;
 	AddSpriteIndex(GET_TRUE_SPRITE_INDEX(index));
 	gAnimFramesToWait = 1;
@@ -564,10 +727,7 @@ void ScriptCmd_loadspritegfx(void)
 void ShinyAnimFix(void)
 {
 	if (GetSpriteTileStartByTag(ANIM_TAG_GOLD_STARS) == 0xFFFF)
-	{
-		LoadCompressedSpriteSheetUsingHeap(&gBattleAnimPicTable[ANIM_TAG_GOLD_STARS - ANIM_SPRITES_START]);
-		LoadCompressedSpritePaletteUsingHeap(&gBattleAnimPaletteTable[ANIM_TAG_GOLD_STARS - ANIM_SPRITES_START]);
-	}
+		LoadAnimSpriteGfx(ANIM_TAG_GOLD_STARS);
 }
 
 void AnimTask_TechnoBlast(u8 taskId)
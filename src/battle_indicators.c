@@ -31,6 +31,13 @@ static bool8 IsIgnoredTriggerColour(u16 colour);
 static struct Sprite* GetHealthboxSprite(u8 bank);
 static u16 ConvertColorToGrayscale(u16 colour);
 static u16 LightUpTriggerSymbol(u16 clra);
+static void PrecomputeTriggerPalettes(void);
+static u8 GetMoveMenuState(u8 bank);
+static u8 GetNumDigits(u32 num);
+static struct IndicatorState* GetIndicatorState(void);
+static const struct Evolution* GetIndicatorMegaEvo(struct IndicatorState* state, u8 bank, bool8 ultra);
+static void UpdateTriggerPosition(struct Sprite* self, const struct IndicatorState* state);
+static void TryUpdateTriggerPalette(struct Sprite* self, u8 triggerPal);
 static void SpriteCB_MegaTrigger(struct Sprite* self);
 static void SpriteCB_MegaIndicator(struct Sprite* self);
 static void SpriteCB_ZTrigger(struct Sprite* self);
@@ -62,6 +69,20 @@ enum
 	MegaTriggerGrayscale,
 };
 
+enum
+{
+	TRIGGER_PAL_MEGA,
+	TRIGGER_PAL_Z_MOVE,
+	TRIGGER_PAL_DYNAMAX,
+};
+
+enum
+{
+	MoveMenuClosed,
+	MoveMenuOpening,
+	MoveMenuOpen,
+};
+
 static const struct CompressedSpriteSheet sMegaIndicatorSpriteSheet = {Mega_IndicatorTiles, (8 * 8) / 2, GFX_TAG_MEGA_INDICATOR};
 static const struct CompressedSpriteSheet sAlphaIndicatorSpriteSheet = {Alpha_IndicatorTiles, (8 * 8) / 2, GFX_TAG_ALPHA_INDICATOR};
 static const struct CompressedSpriteSheet sOmegaIndicatorSpriteSheet = {Omega_IndicatorTiles, (8 * 8) / 2, GFX_TAG_OMEGA_INDICATOR};
@@ -250,6 +271,13 @@ static const u16 sIgnoredTriggerColours[] =
 	RGB(0, 0, 0),
 };
 
+static const u16* const sTriggerPalettes[NUM_TRIGGER_PALETTES] =
+{
+	[TRIGGER_PAL_MEGA] = Mega_TriggerPal,
+	[TRIGGER_PAL_Z_MOVE] = Z_Move_TriggerPal,
+	[TRIGGER_PAL_DYNAMAX] = Dynamax_TriggerPal,
+};
+
 /* Easy match function */
 static bool8 IsIgnoredTriggerColour(u16 colour)
 {
@@ -300,65 +328,189 @@ static u16 LightUpTriggerSymbol(u16 clra)
 	return clr;
 }
 
-#define TRIGGER_BANK self->data[4]
-#define PALETTE_STATE self->data[1]
-#define TAG self->template->tileTag
-#define PAL_TAG self->template->paletteTag
-
-static void SpriteCB_MegaTrigger(struct Sprite* self)
+//Builds the lit, normal, and grayscale versions of every trigger palette once
+//so a state change is just a copy.
+static void PrecomputeTriggerPalettes(void)
 {
-	if (TAG == GFX_TAG_MEGA_TRIGGER)
+	struct IndicatorState* state = gNewBS->indicatorState;
+
+	for (u32 pal = 0; pal < NUM_TRIGGER_PALETTES; ++pal)
 	{
-		if (!CanMegaEvolve(TRIGGER_BANK, FALSE) || gBattleSpritesDataPtr->bankData[TRIGGER_BANK].transformSpecies)
-			self->invisible = TRUE;
-		else
-			self->invisible = FALSE;
+		const u16* src = sTriggerPalettes[pal];
+
+		for (u32 i = 0; i < 16; ++i)
+		{
+			u16 colour = src[i];
+
+			if (i == 0 || IsIgnoredTriggerColour(colour))
+			{
+				state->triggerPalettes[pal][MegaTriggerLightUp - 1][i] = colour;
+				state->triggerPalettes[pal][MegaTriggerNormalColour - 1][i] = colour;
+				state->triggerPalettes[pal][MegaTriggerGrayscale - 1][i] = colour;
+			}
+			else
+			{
+				state->triggerPalettes[pal][MegaTriggerLightUp - 1][i] = LightUpTriggerSymbol(colour);
+				state->triggerPalettes[pal][MegaTriggerNormalColour - 1][i] = colour;
+				state->triggerPalettes[pal][MegaTriggerGrayscale - 1][i] = ConvertColorToGrayscale(colour);
+			}
+		}
 	}
-	else //Ultra Burst
+
+	state->triggerPalettesReady = TRUE;
+}
+
+static u8 GetMoveMenuState(u8 bank)
+{
+	u32 func = gBattleBankFunc[bank];
+
+	if (func == (0x0802EA10 | 1) //Old HandleInputChooseMove
+	||  func == (u32) HandleInputChooseMove
+	||  func == (u32) HandleMoveSwitching)
+		return MoveMenuOpen;
+
+	if (func == (0x08032C90 | 1)  //PlayerHandleChooseMove
+	||  func == (0x08032C4C | 1)) //HandleChooseMoveAfterDma3
+		return MoveMenuOpening;
+
+	return MoveMenuClosed;
+}
+
+static u8 GetNumDigits(u32 num)
+{
+	if (num < 10)
+		return 1;
+	else if (num < 100)
+		return 2;
+
+	return 3;
+}
+
+//Every trigger and indicator sprite reads from here, so the work shared
+//between them is only done by the first callback run each frame.
+static struct IndicatorState* GetIndicatorState(void)
+{
+	struct IndicatorState* state = gNewBS->indicatorState;
+
+	if (!state->built || state->frame != gMain.vblankCounter2)
 	{
-		if (!CanMegaEvolve(TRIGGER_BANK, TRUE) || gBattleSpritesDataPtr->bankData[TRIGGER_BANK].transformSpecies)
-			self->invisible = TRUE;
+		if (gBattleTypeFlags & BATTLE_TYPE_DOUBLE)
+		{
+			state->triggerXShift = -6;
+			state->triggerYShift = -2;
+
+			if (IndexOfSpritePaletteTag(TYPE_ICON_TAG) != 0xFF) //Type icons are shown
+				state->triggerXShift -= 8;
+		}
 		else
-			self->invisible = FALSE;
+		{
+			state->triggerXShift = -5;
+			state->triggerYShift = 1;
+		}
+
+		for (u32 bank = 0; bank < gBattlersCount; ++bank)
+		{
+			struct IndicatorBankState* bankState = &state->bank[bank];
+			struct Sprite* healthbox = GetHealthboxSprite(bank);
+			struct Pokemon* mon = GetBankPartyData(bank);
+
+			bankState->healthbox = healthbox;
+			bankState->healthboxOamX = healthbox->oam.x;
+			bankState->healthboxY = healthbox->pos1.y + healthbox->pos2.y;
+			bankState->healthboxOnScreen = (u8) healthbox->oam.y != 0;
+			bankState->moveMenuState = GetMoveMenuState(bank);
+			bankState->levelDigits = GetNumDigits(mon->level);
+			bankState->holdsMegaStoneOrZCrystal = IsMegaStone(mon->item) || IsZCrystal(mon->item);
+			bankState->megaEvoChecked = FALSE;
+			bankState->ultraEvoChecked = FALSE;
+		}
+
+		state->frame = gMain.vblankCounter2;
+		state->built = TRUE;
 	}
 
-	s16 xshift, yshift;
-	if (gBattleTypeFlags & BATTLE_TYPE_DOUBLE)
+	return state;
+}
+
+//Only the trigger sprites need these, so they're worked out the first time one asks each frame
+static const struct Evolution* GetIndicatorMegaEvo(struct IndicatorState* state, u8 bank, bool8 ultra)
+{
+	struct IndicatorBankState* bankState = &state->bank[bank];
+
+	if (ultra)
 	{
-		xshift = -6;
-		yshift = -2;
+		if (!bankState->ultraEvoChecked)
+		{
+			bankState->ultraEvo = CanMegaEvolve(bank, TRUE);
+			bankState->ultraEvoChecked = TRUE;
+		}
 
-		if (IndexOfSpritePaletteTag(TYPE_ICON_TAG) != 0xFF) //Type icons are shown
-			xshift -= 8;
+		return bankState->ultraEvo;
 	}
-	else
+
+	if (!bankState->megaEvoChecked)
 	{
-		xshift = -5;
-		yshift = 1;
+		bankState->megaEvo = CanMegaEvolve(bank, FALSE);
+		bankState->megaEvoChecked = TRUE;
 	}
 
-	// Find the health box object that this trigger is supposed to be attached to
-	u8 id = gHealthboxIDs[TRIGGER_BANK];
-	struct Sprite* healthbox = &gSprites[id];
+	return bankState->megaEvo;
+}
+
+#define TRIGGER_BANK self->data[4]
+#define PALETTE_STATE self->data[1]
+#define TAG self->template->tileTag
+#define PAL_TAG self->template->paletteTag
 
-	u8 y = healthbox->oam.y;
+static void UpdateTriggerPosition(struct Sprite* self, const struct IndicatorState* state)
+{
+	const struct IndicatorBankState* bankState = &state->bank[TRIGGER_BANK];
 
-	if (y)
+	if (bankState->healthboxOnScreen)
 	{
 		// Copy the healthbox's position (it has various animations)
-		//self->y = healthbox->y + 20;
-		self->pos1.x = (healthbox->oam.x) + xshift + self->data[3];
-		self->pos1.y = healthbox->pos1.y + yshift + healthbox->pos2.y;
+		self->pos1.x = bankState->healthboxOamX + state->triggerXShift + self->data[3];
+		self->pos1.y = bankState->healthboxY + state->triggerYShift;
 	}
 	else
 	{
 		// The box is offscreen, so hide this one as well
 		self->pos1.x = -32;
 	}
+}
 
-	if (gBattleBankFunc[TRIGGER_BANK] == (0x0802EA10 | 1) //Old HandleInputChooseMove
-	||  gBattleBankFunc[TRIGGER_BANK] == (u32) HandleInputChooseMove
-	|| gBattleBankFunc[TRIGGER_BANK] == (u32) HandleMoveSwitching)
+static void TryUpdateTriggerPalette(struct Sprite* self, u8 triggerPal)
+{
+	// Only change the palette if the state has changed
+	if (PALETTE_STATE != self->data[2])
+	{
+		if (PALETTE_STATE != MegaTriggerNothing)
+		{
+			if (!gNewBS->indicatorState->triggerPalettesReady) //Trigger was created before the battle graphics loaded
+				PrecomputeTriggerPalettes();
+
+			u16* pal = &gPlttBufferFaded2[IndexOfSpritePaletteTag(PAL_TAG) * 16];
+			CpuCopy16(&gNewBS->indicatorState->triggerPalettes[triggerPal][PALETTE_STATE - 1][1], &pal[1], 15 * sizeof(u16));
+		}
+
+		self->data[2] = PALETTE_STATE;
+	}
+}
+
+static void SpriteCB_MegaTrigger(struct Sprite* self)
+{
+	struct IndicatorState* state = GetIndicatorState();
+	struct IndicatorBankState* bankState = &state->bank[TRIGGER_BANK];
+	const struct Evolution* evo = GetIndicatorMegaEvo(state, TRIGGER_BANK, TAG != GFX_TAG_MEGA_TRIGGER);
+
+	if (evo == NULL || gBattleSpritesDataPtr->bankData[TRIGGER_BANK].transformSpecies)
+		self->invisible = TRUE;
+	else
+		self->invisible = FALSE;
+
+	UpdateTriggerPosition(self, state);
+
+	if (bankState->moveMenuState == MoveMenuOpen)
 	{
 		if (self->data[3] > 0)
 			self->data[3] -= 2;
@@ -368,8 +520,7 @@ static void SpriteCB_MegaTrigger(struct Sprite* self)
 
 	//Mega Trigger should recede and destroy itself as long as the game isn't
 	//running one of the two mentioned functions.
-	else if (gBattleBankFunc[TRIGGER_BANK] != (0x08032C90 | 1)  //PlayerHandleChooseMove
-		  && gBattleBankFunc[TRIGGER_BANK] != (0x08032C4C | 1)) //HandleChooseMoveAfterDma3
+	else if (bankState->moveMenuState != MoveMenuOpening)
 	{
 		if (self->data[3] < 24)
 			self->data[3] += 2;
@@ -381,11 +532,9 @@ static void SpriteCB_MegaTrigger(struct Sprite* self)
 		}
 	}
 
-  	const struct Evolution* evo;
 	if (TAG == GFX_TAG_MEGA_TRIGGER)
 	{
-		evo = CanMegaEvolve(TRIGGER_BANK, FALSE);
-		if (evo->unknown != MEGA_VARIANT_ULTRA_BURST)
+		if (evo != NULL && evo->unknown != MEGA_VARIANT_ULTRA_BURST)
 		{
 			if (gNewBS->MegaData->done[TRIGGER_BANK]
 			||  DoesZMoveUsageStopMegaEvolution(TRIGGER_BANK)
@@ -402,8 +551,7 @@ static void SpriteCB_MegaTrigger(struct Sprite* self)
 	}
 	else //TAG == GFX_TAG_ULTRA_TRIGGER
 	{
-		evo = CanMegaEvolve(TRIGGER_BANK, TRUE);
-		if (evo->unknown == MEGA_VARIANT_ULTRA_BURST)
+		if (evo != NULL && evo->unknown == MEGA_VARIANT_ULTRA_BURST)
 		{
 			if (gNewBS->UltraData->done[TRIGGER_BANK]
 			||  DoesDynamaxUsageStopMegaEvolution(TRIGGER_BANK))
@@ -418,31 +566,7 @@ static void SpriteCB_MegaTrigger(struct Sprite* self)
 		}
 	}
 
-	// Only change the palette if the state has changed
-	if (PALETTE_STATE != self->data[2])
-	{
-		u16* pal = &gPlttBufferFaded2[IndexOfSpritePaletteTag(PAL_TAG) * 16];
-		u8 i;
-
-		for(i = 1; i < 16; i++)
-		{
-			if (IsIgnoredTriggerColour(Mega_TriggerPal[i])) continue;
-
-			switch(PALETTE_STATE) {
-				case MegaTriggerLightUp:
-					pal[i] = LightUpTriggerSymbol(Mega_TriggerPal[i]);
-					break;
-				case MegaTriggerNormalColour:
-					pal[i] = Mega_TriggerPal[i];
-					break;
-				case MegaTriggerGrayscale:
-					pal[i] = ConvertColorToGrayscale(Mega_TriggerPal[i]);
-					break;
-			}
-		}
-
-		self->data[2] = PALETTE_STATE;
-	}
+	TryUpdateTriggerPalette(self, TRIGGER_PAL_MEGA);
 }
 
 #define INDICATOR_BANK self->data[0]
@@ -490,7 +614,8 @@ static void SpriteCB_MegaIndicator(struct Sprite* self)
 			}
 	}
 
-	struct Sprite* healthbox = GetHealthboxSprite(INDICATOR_BANK);
+	struct IndicatorBankState* bankState = &GetIndicatorState()->bank[INDICATOR_BANK];
+	struct Sprite* healthbox = bankState->healthbox;
 
 	if (healthbox->invisible)
 	{
@@ -502,13 +627,12 @@ static void SpriteCB_MegaIndicator(struct Sprite* self)
 		self->invisible = FALSE;
 	}
 
-	u8 y = healthbox->oam.y;
-	s8 x = healthbox->oam.x;
+	s8 x = bankState->healthboxOamX;
 
 	// Mirror healthbox priority
 	self->oam.priority = healthbox->oam.priority;
 
-	if (y)
+	if (bankState->healthboxOnScreen)
 	{
 		self->invisible = FALSE;
 
@@ -521,12 +645,9 @@ static void SpriteCB_MegaIndicator(struct Sprite* self)
 		else
 			shift += 26;
 
-		// Convert the level to a string to get how long it is
-		u8 buf[10];
-		u8 stringlen = ConvertIntToDecimalStringN(buf, GetBankPartyData(INDICATOR_BANK)->level, 0, 3) - buf;
-
 		// The x position depends on the X origin of the healthbox as well as
-		// the string length
+		// the length of the level string
+		u8 stringlen = bankState->levelDigits;
 		if (SIDE(INDICATOR_BANK) == B_SIDE_OPPONENT)
 			self->pos1.x = x + shift - 5 * stringlen;
 		else
@@ -563,43 +684,12 @@ static void SpriteCB_MegaIndicator(struct Sprite* self)
 
 static void SpriteCB_ZTrigger(struct Sprite* self)
 {
-	s16 xshift, yshift;
-	if (gBattleTypeFlags & BATTLE_TYPE_DOUBLE)
-	{
-		xshift = -6;
-		yshift = -2;
-
-		if (IndexOfSpritePaletteTag(TYPE_ICON_TAG) != 0xFF) //Type icons are shown
-			xshift -= 8;
-	}
-	else
-	{
-		xshift = -5;
-		yshift = 1;
-	}
+	struct IndicatorState* state = GetIndicatorState();
+	struct IndicatorBankState* bankState = &state->bank[TRIGGER_BANK];
 
-	// Find the health box object that this trigger is supposed to be attached to
-	u8 id = gHealthboxIDs[TRIGGER_BANK];
-	struct Sprite* healthbox = &gSprites[id];
+	UpdateTriggerPosition(self, state);
 
-	u8 y = healthbox->oam.y;
-
-	if (y)
-	{
-		// Copy the healthbox's position (it has various animations)
-		//self->y = healthbox->y + 20;
-		self->pos1.x = (healthbox->oam.x) + xshift + self->data[3];
-		self->pos1.y = healthbox->pos1.y + yshift + healthbox->pos2.y;
-	}
-	else
-	{
-		// The box is offscreen, so hide this one as well
-		self->pos1.x = -32;
-	}
-
-	if (gBattleBankFunc[TRIGGER_BANK] == (0x0802EA10 | 1) //Old HandleInputChooseMove
-	||  gBattleBankFunc[TRIGGER_BANK] == (u32) HandleInputChooseMove
-	|| gBattleBankFunc[TRIGGER_BANK] == (u32) HandleMoveSwitching)
+	if (bankState->moveMenuState == MoveMenuOpen)
 	{
 		struct ChooseMoveStruct* moveInfo = (struct ChooseMoveStruct*) (&gBattleBufferA[TRIGGER_BANK][4]);
 
@@ -619,10 +709,9 @@ static void SpriteCB_ZTrigger(struct Sprite* self)
 		}
 	}
 
-	//Mega Trigger should recede and destroy itself as long as the game isn't
+	//Z-Move Trigger should recede and destroy itself as long as the game isn't
 	//running one of the two mentioned functions.
-	else if (gBattleBankFunc[TRIGGER_BANK] != (0x08032C90 | 1)  //PlayerHandleChooseMove
-		  && gBattleBankFunc[TRIGGER_BANK] != (0x08032C4C | 1)) //HandleChooseMoveAfterDma3
+	else if (bankState->moveMenuState != MoveMenuOpening)
 	{
 		if (self->data[3] < 24)
 			self->data[3] += 2;
@@ -639,74 +728,20 @@ static void SpriteCB_ZTrigger(struct Sprite* self)
 	else
 		PALETTE_STATE = MegaTriggerNormalColour;
 
-	// Only change the palette if the state has changed
-	if (PALETTE_STATE != self->data[2])
-	{
-		u16* pal = &gPlttBufferFaded2[IndexOfSpritePaletteTag(GFX_TAG_Z_TRIGGER) * 16];
-		u8 i;
-
-		for(i = 1; i < 16; i++)
-		{
-			if (IsIgnoredTriggerColour(Z_Move_TriggerPal[i])) continue;
-
-			switch(PALETTE_STATE) {
-				case MegaTriggerLightUp:
-					pal[i] = LightUpTriggerSymbol(Z_Move_TriggerPal[i]);
-					break;
-				case MegaTriggerNormalColour:
-					pal[i] = Z_Move_TriggerPal[i];
-					break;
-			}
-		}
-
-		self->data[2] = PALETTE_STATE;
-	}
+	TryUpdateTriggerPalette(self, TRIGGER_PAL_Z_MOVE);
 }
 
 static void SpriteCB_DynamaxTrigger(struct Sprite* self)
 {
-	s16 xshift, yshift;
+	struct IndicatorState* state = GetIndicatorState();
+	struct IndicatorBankState* bankState = &state->bank[TRIGGER_BANK];
 
-	if (gBattleTypeFlags & BATTLE_TYPE_DOUBLE)
-	{
-		xshift = -6;
-		yshift = -2;
-
-		if (IndexOfSpritePaletteTag(TYPE_ICON_TAG) != 0xFF) //Type icons are shown
-			xshift -= 8;
-	}
-	else
-	{
-		xshift = -5;
-		yshift = 1;
-	}
-	
-	if (IsMegaStone(GetBankPartyData(TRIGGER_BANK)->item)
-	||  IsZCrystal(GetBankPartyData(TRIGGER_BANK)->item))
+	if (bankState->holdsMegaStoneOrZCrystal)
 		return; //Can't Dynamax if holding one of these two types of items
 
-	// Find the health box object that this trigger is supposed to be attached to
-	u8 id = gHealthboxIDs[TRIGGER_BANK];
-	struct Sprite* healthbox = &gSprites[id];
-
-	u8 y = healthbox->oam.y;
-
-	if (y)
-	{
-		// Copy the healthbox's position (it has various animations)
-		//self->y = healthbox->y + 20;
-		self->pos1.x = (healthbox->oam.x) + xshift + self->data[3];
-		self->pos1.y = healthbox->pos1.y + yshift + healthbox->pos2.y;
-	}
-	else
-	{
-		// The box is offscreen, so hide this one as well
-		self->pos1.x = -32;
-	}
+	UpdateTriggerPosition(self, state);
 
-	if (gBattleBankFunc[TRIGGER_BANK] == (0x0802EA10 | 1) //Old HandleInputChooseMove
-	||  gBattleBankFunc[TRIGGER_BANK] == (u32) HandleInputChooseMove
-	|| gBattleBankFunc[TRIGGER_BANK] == (u32) HandleMoveSwitching)
+	if (bankState->moveMenuState == MoveMenuOpen)
 	{
 		struct ChooseMoveStruct* moveInfo = (struct ChooseMoveStruct*) (&gBattleBufferA[TRIGGER_BANK][4]);
 
@@ -728,8 +763,7 @@ static void SpriteCB_DynamaxTrigger(struct Sprite* self)
 
 	//Dynamax Trigger should recede and destroy itself as long as the game isn't
 	//running one of the two mentioned functions.
-	else if (gBattleBankFunc[TRIGGER_BANK] != (0x08032C90 | 1)  //PlayerHandleChooseMove
-		  && gBattleBankFunc[TRIGGER_BANK] != (0x08032C4C | 1)) //HandleChooseMoveAfterDma3
+	else if (bankState->moveMenuState != MoveMenuOpening)
 	{
 		if (self->data[3] < 24)
 			self->data[3] += 2;
@@ -746,37 +780,15 @@ static void SpriteCB_DynamaxTrigger(struct Sprite* self)
 	else
 		PALETTE_STATE = MegaTriggerNormalColour;
 
-	// Only change the palette if the state has changed
-	if (PALETTE_STATE != self->data[2])
-	{
-		u16* pal = &gPlttBufferFaded2[IndexOfSpritePaletteTag(GFX_TAG_DYNAMAX_TRIGGER) * 16];
-		u8 i;
-
-		for(i = 1; i < 16; i++)
-		{
-			if (IsIgnoredTriggerColour(Dynamax_TriggerPal[i])) continue;
-
-			switch(PALETTE_STATE) {
-				case MegaTriggerLightUp:
-					pal[i] = LightUpTriggerSymbol(Dynamax_TriggerPal[i]);
-					break;
-				case MegaTriggerNormalColour:
-					pal[i] = Dynamax_TriggerPal[i];
-					break;
-			}
-		}
-
-		self->data[2] = PALETTE_STATE;
-	}
+	TryUpdateTriggerPalette(self, TRIGGER_PAL_DYNAMAX);
 }
 
 static void SpriteCB_RaidShield(struct Sprite* sprite)
 {
-	u8 bank = sprite->data[0];
 	s16 offset = sprite->data[1];
 
 	//Deal with bouncing player healthbox
-	struct Sprite* healthbox = &gSprites[gHealthboxIDs[bank]];
+	struct Sprite* healthbox = GetIndicatorState()->bank[sprite->data[0]].healthbox;
 	sprite->pos1.x = healthbox->pos1.x + 50;
 	sprite->pos1.y = healthbox->pos1.y + 12;
 
@@ -801,6 +813,9 @@ void LoadMegaGraphics(u8 state)
 {
 	u8 spriteId;
 
+	if (!gNewBS->indicatorState->triggerPalettesReady)
+		PrecomputeTriggerPalettes();
+
 	if (state == 2 || state == 0xFF)
 	{
 		bool8 loadedMegaGfx = IndexOfSpriteTileTag(GFX_TAG_MEGA_INDICATOR) != 0xFF;
@@ -738,11 +738,13 @@ void DoFieldEffect(void)
 			if (gNewBS->MagicRoomTimer)
 			{
 				gNewBS->MagicRoomTimer = 0;
+				InvalidateBattlerAttributeCaches();
 				gBattleStringLoader = MagicRoomEndString;
 			}
 			else if (!IsMagicRoomActive())
 			{
 				gNewBS->MagicRoomTimer = 5;
+				InvalidateBattlerAttributeCaches();
 				gBattleStringLoader = MagicRoomSetString;
 			}
 			else
@@ -753,6 +755,7 @@ void DoFieldEffect(void)
 			if (gNewBS->GravityTimer > 0)
 			{
 				gNewBS->GravityTimer = 0;
+				InvalidateBattlerAttributeCaches();
 				gBattleStringLoader = GravityEndString;
 			}
 			else if (!IsGravityActive())
@@ -764,6 +767,7 @@ void DoFieldEffect(void)
 				}
 
 				gNewBS->GravityTimer = 5;
+				InvalidateBattlerAttributeCaches();
 				gBattleStringLoader = GravitySetString;
 			}
 			else
@@ -12,6 +12,7 @@
 #include "../include/new/ai_master.h"
 #include "../include/new/battle_start_turn_start.h"
 #include "../include/new/battle_start_turn_start_battle_scripts.h"
+#include "../include/new/battle_transition.h"
 #include "../include/new/battle_util.h"
 #include "../include/new/cmd49.h"
 #include "../include/new/damage_calc.h"
@@ -87,10 +88,14 @@ static u32 BoostSpeedByItemEffect(u8 itemEffect, u8 itemQuality, u16 species, u3
 
 void HandleNewBattleRamClearBeforeBattle(void)
 {
+	ClearMugshotPreload(); //In case the transition didn't use it
 	gNewBS = Calloc(sizeof(struct NewBattleStruct));
 	gNewBS->MegaData = Calloc(sizeof(struct MegaData));
 	gNewBS->UltraData = Calloc(sizeof(struct UltraData));
 	gNewBS->ZMoveData = Calloc(sizeof(struct ZMoveData));
+	gNewBS->abilityPopUpCache = Calloc(sizeof(struct AbilityPopUpCache));
+	gNewBS->indicatorState = Calloc(sizeof(struct IndicatorState));
+	gNewBS->animSheetCache = Calloc(sizeof(struct AnimSheetCache));
 	Memset(FIRST_NEW_BATTLE_RAM_LOC, 0, (u32) LAST_NEW_BATTLE_RAM_LOC - (u32) FIRST_NEW_BATTLE_RAM_LOC);
 	Memset(gBattleBufferA, 0x0, sizeof(Battle_Buffer_T) * MAX_BATTLERS_COUNT * 2); //Clear both battle buffers
 	//Memset((u8*) 0x203C020, 0x0, 0xE0);
@@ -311,6 +316,7 @@ void BattleBeginFirstTurn(void)
 						BattleScriptPushCursorAndCallback(BattleScript_AirBalloonFloat);
 						gBankAttacker = gBattleScripting->bank = gBanksByTurnOrder[*bank];
 						RecordItemEffectBattle(gBankAttacker, ITEM_EFFECT_AIR_BALLOON);
+						RecordItemWorkedBattle(gBankAttacker);
 						++effect;
 					}
 					++*bank;
@@ -487,6 +493,8 @@ void SetActionsAndBanksTurnOrder(void)
 	s32 turnOrderId = 0;
 	s32 i, j;
 
+	InvalidateUsableMoveCaches(); //Action selection is over
+
 	if (gBattleTypeFlags & BATTLE_TYPE_SAFARI)
 	{
 		for (gActiveBattler = 0; gActiveBattler < gBattlersCount; ++gActiveBattler) {
@@ -815,6 +823,7 @@ void RunTurnActionsFunctions(void)
 						gLastUsedItem = ITEM(i);
 						if (ITEM_EFFECT(i) != ITEM_EFFECT_CUSTAP_BERRY)
 							RecordItemEffectBattle(i, ITEM_EFFECT(i));
+						RecordItemWorkedBattle(i);
 
 						BattleScriptExecute(BattleScript_QuickClaw);
 						return;
@@ -1619,27 +1628,26 @@ s32 BracketCalc(u8 bank)
 
 static u32 BoostSpeedInWeather(u8 ability, u8 itemEffect, u32 speed)
 {
-	if (WEATHER_HAS_EFFECT) {
-		switch (ability) {
-			case ABILITY_SWIFTSWIM:
-				if (gBattleWeather & WEATHER_RAIN_ANY && itemEffect != ITEM_EFFECT_UTILITY_UMBRELLA)
-					speed *= 2;
-				break;
-			case ABILITY_CHLOROPHYLL:
-				if (gBattleWeather & WEATHER_SUN_ANY && itemEffect != ITEM_EFFECT_UTILITY_UMBRELLA)
-					speed *= 2;
-				break;
-			case ABILITY_SANDRUSH:
-				if (gBattleWeather & WEATHER_SANDSTORM_ANY)
-					speed *= 2;
-				break;
-			case ABILITY_SLUSHRUSH:
-				if (gBattleWeather & WEATHER_HAIL_ANY)
-					speed *= 2;
-				break;
-		}
+	bool8 boosted = FALSE;
+
+	switch (ability) {
+		case ABILITY_SWIFTSWIM:
+			boosted = gBattleWeather & WEATHER_RAIN_ANY && itemEffect != ITEM_EFFECT_UTILITY_UMBRELLA;
+			break;
+		case ABILITY_CHLOROPHYLL:
+			boosted = gBattleWeather & WEATHER_SUN_ANY && itemEffect != ITEM_EFFECT_UTILITY_UMBRELLA;
+			break;
+		case ABILITY_SANDRUSH:
+			boosted = (gBattleWeather & WEATHER_SANDSTORM_ANY) != 0;
+			break;
+		case ABILITY_SLUSHRUSH:
+			boosted = (gBattleWeather & WEATHER_HAIL_ANY) != 0;
+			break;
 	}
 
+	if (boosted && WEATHER_HAS_EFFECT) //Only scan the field for Cloud Nine/Air Lock when it matters
+		speed *= 2;
+
 	return speed;
 }
 
@@ -1705,10 +1713,10 @@ u32 SpeedCalc(u8 bank)
 
 	#ifdef BADGE_BOOSTS
 		if (!(gBattleTypeFlags & (BATTLE_TYPE_LINK | BATTLE_TYPE_TRAINER_TOWER | BATTLE_TYPE_FRONTIER | BATTLE_TYPE_EREADER_TRAINER))
-		&& FlagGet(FLAG_BADGE03_GET)
 		&& gBattleTypeFlags & BATTLE_TYPE_TRAINER
 		&& SIDE(bank) == B_SIDE_PLAYER
-		&& gTrainerBattleOpponent_A != 0x400)
+		&& gTrainerBattleOpponent_A != 0x400
+		&& FlagGet(FLAG_BADGE03_GET))
 			speed = (speed * 110) / 100;
 	#endif
 
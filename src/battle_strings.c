@@ -48,6 +48,7 @@ const u8 * const gStatusConditionStringsTable[11][2] =
 };
 
 //This file's functions:
+static const u8* GetBattlerDisplayName(u8 bank, u8* buffer);
 #ifdef OPEN_WORLD_TRAINERS
 static u8* GetOpenWorldTrainerName(bool8 female);
 #endif
@@ -414,6 +415,31 @@ void BufferStringBattle(u16 stringID)
 	BattleStringExpandPlaceholdersToDisplayedString(stringPtr);
 }
 
+//Battle messages name the same few mons over and over, so each battler's name
+//is kept until the mon it's shown as changes (switching, Illusion breaking).
+static const u8* GetBattlerDisplayName(u8 bank, u8* buffer)
+{
+	const struct Pokemon* mon = GetIllusionPartyData(bank);
+	struct BattlerNameCache* cache;
+
+	if (gNewBS == NULL)
+	{
+		GetMonData(mon, MON_DATA_NICKNAME, buffer);
+		StringGetEnd10(buffer);
+		return buffer;
+	}
+
+	cache = &gNewBS->nameCache[bank];
+	if (cache->mon != mon)
+	{
+		GetMonData(mon, MON_DATA_NICKNAME, cache->name);
+		StringGetEnd10(cache->name);
+		cache->mon = mon;
+	}
+
+	return cache->name;
+}
+
 u32 BattleStringExpandPlaceholders(const u8* src, u8* dst)
 {
 	int i;
@@ -473,64 +499,34 @@ u32 BattleStringExpandPlaceholders(const u8* src, u8* dst)
 				toCpy = gStringVar3;
 				break;
 			case B_TXT_PLAYER_MON1_NAME: // first player poke name
-				GetMonData(GetIllusionPartyData(GetBattlerAtPosition(B_POSITION_PLAYER_LEFT)),
-						   MON_DATA_NICKNAME, text);
-				StringGetEnd10(text);
-				toCpy = text;
+				toCpy = GetBattlerDisplayName(GetBattlerAtPosition(B_POSITION_PLAYER_LEFT), text);
 				break;
 			case B_TXT_OPPONENT_MON1_NAME: // first enemy poke name
-				GetMonData(GetIllusionPartyData(GetBattlerAtPosition(B_POSITION_OPPONENT_LEFT)),
-						   MON_DATA_NICKNAME, text);
-				StringGetEnd10(text);
-				toCpy = text;
+				toCpy = GetBattlerDisplayName(GetBattlerAtPosition(B_POSITION_OPPONENT_LEFT), text);
 				break;
 			case B_TXT_PLAYER_MON2_NAME: // second player poke name
-				GetMonData(GetIllusionPartyData(GetBattlerAtPosition(B_POSITION_PLAYER_RIGHT)),
-						   MON_DATA_NICKNAME, text);
-				StringGetEnd10(text);
-				toCpy = text;
+				toCpy = GetBattlerDisplayName(GetBattlerAtPosition(B_POSITION_PLAYER_RIGHT), text);
 				break;
 			case B_TXT_OPPONENT_MON2_NAME: // second enemy poke name
-				GetMonData(GetIllusionPartyData(GetBattlerAtPosition(B_POSITION_OPPONENT_RIGHT)),
-						   MON_DATA_NICKNAME, text);
-				StringGetEnd10(text);
-				toCpy = text;
+				toCpy = GetBattlerDisplayName(GetBattlerAtPosition(B_POSITION_OPPONENT_RIGHT), text);
 				break;
 			case B_TXT_LINK_PLAYER_MON1_NAME: // link first player poke name
-				GetMonData(GetIllusionPartyData(gLinkPlayers[multiplayerId].id),
-						   MON_DATA_NICKNAME, text);
-				StringGetEnd10(text);
-				toCpy = text;
+				toCpy = GetBattlerDisplayName(gLinkPlayers[multiplayerId].id, text);
 				break;
 			case B_TXT_LINK_OPPONENT_MON1_NAME: // link first opponent poke name
-				GetMonData(GetIllusionPartyData(gLinkPlayers[multiplayerId].id ^ 1),
-						   MON_DATA_NICKNAME, text);
-				StringGetEnd10(text);
-				toCpy = text;
+				toCpy = GetBattlerDisplayName(gLinkPlayers[multiplayerId].id ^ 1, text);
 				break;
 			case B_TXT_LINK_PLAYER_MON2_NAME: // link second player poke name
-				GetMonData(GetIllusionPartyData(gLinkPlayers[multiplayerId].id ^ 2),
-						   MON_DATA_NICKNAME, text);
-				StringGetEnd10(text);
-				toCpy = text;
+				toCpy = GetBattlerDisplayName(gLinkPlayers[multiplayerId].id ^ 2, text);
 				break;
 			case B_TXT_LINK_OPPONENT_MON2_NAME: // link second opponent poke name
-				GetMonData(GetIllusionPartyData(gLinkPlayers[multiplayerId].id ^ 3),
-						   MON_DATA_NICKNAME, text);
-				StringGetEnd10(text);
-				toCpy = text;
+				toCpy = GetBattlerDisplayName(gLinkPlayers[multiplayerId].id ^ 3, text);
 				break;
 			case B_TXT_ATK_NAME_WITH_PREFIX_MON1: // attacker name with prefix, only battlerId 0/1
 				HANDLE_NICKNAME_STRING_CASE(gBankAttacker, GetBattlerAtPosition(SIDE(gBankAttacker)));
 				break;
 			case B_TXT_ATK_PARTNER_NAME: // attacker partner name
-				if (SIDE(gBankAttacker) == B_SIDE_PLAYER)
-					GetMonData(GetIllusionPartyData(gBankAttacker ^ BIT_FLANK), MON_DATA_NICKNAME, text);
-				else
-					GetMonData(GetIllusionPartyData(gBankAttacker ^ BIT_FLANK), MON_DATA_NICKNAME, text);
-
-				StringGetEnd10(text);
-				toCpy = text;
+				toCpy = GetBattlerDisplayName(gBankAttacker ^ BIT_FLANK, text);
 				break;
 			case B_TXT_ATK_NAME_WITH_PREFIX: // attacker name with prefix
 				HANDLE_NICKNAME_STRING_CASE(gBankAttacker, gBankAttacker);
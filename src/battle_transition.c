@@ -32,6 +32,24 @@ battle_transition.c
 
 #define GFX_TAG_VS_SYMBOL 0xFDF0
 
+#define MUGSHOT_PRELOAD_MAGIC 0x4D554750 //"MUGP"
+#define MUGSHOT_PRELOAD_COUNT 3 //Opponent A, Opponent B, Player
+
+struct MugshotPreloadEntry
+{
+	const u8* src; //Compressed sheet this was decompressed from
+	u8* data;
+	u16 tag;
+};
+
+struct MugshotPreload
+{
+	u32 built;
+	struct MugshotPreloadEntry entries[MUGSHOT_PRELOAD_COUNT];
+};
+
+#define sMugshotPreload ((struct MugshotPreload*) 0x203F318)
+
 //Structures
 extern const struct MugshotTable sPreBattleMugshotSprites[147];
 extern const u16* const sMugshotsBigPals[];
@@ -47,6 +65,11 @@ extern const u16* const sMugshotPlayerPals[];
 static u8 CreateMugshotTrainerSprite(u8 trainerSpriteID, s16 x, s16 y, u8 subpriority, u8* buffer, bool8 loadingPlayer);
 static void UpdateMugshotSpriteTemplate(struct SpriteTemplate* spriteTemplate, u16 tag);
 static void UpdateMugshotSpriteData(u8 spriteId, u8 shape, u16 scaleX, u16 scaleY, u16 rotation, bool8 setScale);
+static void GetMugshotSpriteSheet(struct CompressedSpriteSheet* sheet, u8 trainerSpriteID, bool8 loadingPlayer);
+static void PreloadMugshotSpriteSheet(u8 trainerSpriteID, bool8 loadingPlayer, u8 slot);
+static void LoadMugshotSpriteSheet(const struct CompressedSpriteSheet* src, u8* buffer);
+static void Task_PreloadMugshots(u8 taskId);
+static bool8 TrainerBattleUsesMugshots(void);
 
 //For pre-battle mugshots
 static u8 CreateMugshotTrainerSprite(u8 trainerSpriteID, s16 x, s16 y, u8 subpriority, u8* buffer, bool8 loadingPlayer)
@@ -64,7 +87,7 @@ static u8 CreateMugshotTrainerSprite(u8 trainerSpriteID, s16 x, s16 y, u8 subpri
 				struct CompressedSpritePalette pal = {VS_SpritePal, gTrainerFrontPicPaletteTable[trainerSpriteID].tag};
 				struct CompressedSpriteSheet sprite = {VS_SpriteTiles, 64 * 64 / 2, gTrainerFrontPicTable[trainerSpriteID].tag};
 				LoadCompressedSpritePaletteOverrideBuffer(&pal, buffer);
-				LoadCompressedSpriteSheetOverrideBuffer(&sprite, buffer);
+				LoadMugshotSpriteSheet(&sprite, buffer);
 			}
 			else
 			{
@@ -76,21 +99,21 @@ static u8 CreateMugshotTrainerSprite(u8 trainerSpriteID, s16 x, s16 y, u8 subpri
 						struct CompressedSpritePalette pal = {sPreBattleMugshotSprites[trainerSpriteID].pal, gTrainerFrontPicPaletteTable[trainerSpriteID].tag};
 						struct CompressedSpriteSheet sprite = {sPreBattleMugshotSprites[trainerSpriteID].sprite, sPreBattleMugshotSprites[trainerSpriteID].size, gTrainerFrontPicTable[trainerSpriteID].tag};
 						LoadCompressedSpritePaletteOverrideBuffer(&pal, buffer);
-						LoadCompressedSpriteSheetOverrideBuffer(&sprite, buffer);
+						LoadMugshotSpriteSheet(&sprite, buffer);
 						x += sPreBattleMugshotSprites[trainerSpriteID].x;
 						y += sPreBattleMugshotSprites[trainerSpriteID].y;
 					}
 					else
 					{
 						LoadCompressedSpritePaletteOverrideBuffer(&gTrainerFrontPicPaletteTable[trainerSpriteID], buffer);
-						LoadCompressedSpriteSheetOverrideBuffer(&gTrainerFrontPicTable[trainerSpriteID], buffer);
+						LoadMugshotSpriteSheet(&gTrainerFrontPicTable[trainerSpriteID], buffer);
 					}
 				}
 				else
 				#endif
 				{
 					LoadCompressedSpritePaletteOverrideBuffer(&gTrainerFrontPicPaletteTable[trainerSpriteID], buffer);
-					LoadCompressedSpriteSheetOverrideBuffer(&gTrainerFrontPicTable[trainerSpriteID], buffer);
+					LoadMugshotSpriteSheet(&gTrainerFrontPicTable[trainerSpriteID], buffer);
 				}
 			}
 			break;
@@ -105,7 +128,7 @@ static u8 CreateMugshotTrainerSprite(u8 trainerSpriteID, s16 x, s16 y, u8 subpri
 					struct CompressedSpritePalette pal = {sPreBattleMugshotSprites[trainerSpriteID].pal, gTrainerFrontPicPaletteTable[trainerSpriteID].tag};
 					struct CompressedSpriteSheet sprite = {sPreBattleMugshotSprites[trainerSpriteID].sprite, sPreBattleMugshotSprites[trainerSpriteID].size, gTrainerFrontPicTable[trainerSpriteID].tag};
 					LoadCompressedSpritePaletteOverrideBuffer(&pal, buffer);
-					LoadCompressedSpriteSheetOverrideBuffer(&sprite, buffer);
+					LoadMugshotSpriteSheet(&sprite, buffer);
 					x += sPreBattleMugshotSprites[trainerSpriteID].x;
 					y += sPreBattleMugshotSprites[trainerSpriteID].y;
 				}
@@ -114,7 +137,7 @@ static u8 CreateMugshotTrainerSprite(u8 trainerSpriteID, s16 x, s16 y, u8 subpri
 					++loadingPlayer; //So compiler doesn't complain
 					struct CompressedSpritePalette palStruct = {GetTrainerSpritePal(trainerSpriteID), gTrainerFrontPicPaletteTable[trainerSpriteID].tag};
 					LoadCompressedSpritePaletteOverrideBuffer(&palStruct, buffer);
-					LoadCompressedSpriteSheetOverrideBuffer(&gTrainerFrontPicTable[trainerSpriteID], buffer);
+					LoadMugshotSpriteSheet(&gTrainerFrontPicTable[trainerSpriteID], buffer);
 				}
 			}
 			else
@@ -123,7 +146,7 @@ static u8 CreateMugshotTrainerSprite(u8 trainerSpriteID, s16 x, s16 y, u8 subpri
 				++loadingPlayer; //So compiler doesn't complain
 				struct CompressedSpritePalette palStruct = {GetTrainerSpritePal(trainerSpriteID), gTrainerFrontPicPaletteTable[trainerSpriteID].tag};
 				LoadCompressedSpritePaletteOverrideBuffer(&palStruct, buffer);
-				LoadCompressedSpriteSheetOverrideBuffer(&gTrainerFrontPicTable[trainerSpriteID], buffer);
+				LoadMugshotSpriteSheet(&gTrainerFrontPicTable[trainerSpriteID], buffer);
 			}
 			break;
 	}
@@ -438,6 +461,8 @@ void Mugshots_CreateOpponentPlayerSprites(struct Task* task)
 	#endif
 	else
 		SetOamMatrixRotationScaling(playerSprite->oam.matrixNum, -512, 512, 0);
+
+	ClearMugshotPreload(); //Everything is in VRAM now
 }
 
 
@@ -468,6 +493,127 @@ static void UpdateMugshotSpriteData(u8 spriteId, u8 shape, u16 scaleX, u16 scale
 		SetOamMatrixRotationScaling(sprite->oam.matrixNum, scaleX, scaleY, rotation);
 }
 
+//Mirrors the sheet choice in CreateMugshotTrainerSprite
+static void GetMugshotSpriteSheet(struct CompressedSpriteSheet* sheet, u8 trainerSpriteID, bool8 loadingPlayer)
+{
+	sheet->tag = gTrainerFrontPicTable[trainerSpriteID].tag;
+
+	if (loadingPlayer && VarGet(VAR_PRE_BATTLE_MUGSHOT_SPRITE) == MUGSHOT_VS_SYMBOL)
+	{
+		sheet->data = VS_SpriteTiles;
+		sheet->size = 64 * 64 / 2;
+		return;
+	}
+
+	#ifdef FLAG_LOAD_MUGSHOT_SPRITE_FROM_TABLE
+	if (FlagGet(FLAG_LOAD_MUGSHOT_SPRITE_FROM_TABLE) && IS_VALID_TABLE_SPRITE(trainerSpriteID))
+	{
+		sheet->data = sPreBattleMugshotSprites[trainerSpriteID].sprite;
+		sheet->size = sPreBattleMugshotSprites[trainerSpriteID].size;
+		return;
+	}
+	#endif
+
+	sheet->data = gTrainerFrontPicTable[trainerSpriteID].data;
+	sheet->size = gTrainerFrontPicTable[trainerSpriteID].size;
+}
+
+static void PreloadMugshotSpriteSheet(u8 trainerSpriteID, bool8 loadingPlayer, u8 slot)
+{
+	struct CompressedSpriteSheet sheet;
+	struct MugshotPreloadEntry* entry = &sMugshotPreload->entries[slot];
+
+	GetMugshotSpriteSheet(&sheet, trainerSpriteID, loadingPlayer);
+	entry->data = Malloc(*((const u32*) sheet.data) >> 8); //Size from the LZ77 header
+	if (entry->data != NULL)
+	{
+		LZ77UnCompWram(sheet.data, entry->data);
+		entry->src = sheet.data;
+		entry->tag = sheet.tag;
+	}
+}
+
+static void LoadMugshotSpriteSheet(const struct CompressedSpriteSheet* src, u8* buffer)
+{
+	if (sMugshotPreload->built == MUGSHOT_PRELOAD_MAGIC)
+	{
+		for (u32 i = 0; i < MUGSHOT_PRELOAD_COUNT; ++i)
+		{
+			struct MugshotPreloadEntry* entry = &sMugshotPreload->entries[i];
+
+			if (entry->data != NULL && entry->src == src->data && entry->tag == src->tag)
+			{
+				struct SpriteSheet sheet = {entry->data, src->size, src->tag};
+				LoadSpriteSheet(&sheet);
+				Free(entry->data);
+				entry->data = NULL;
+				return;
+			}
+		}
+	}
+
+	LoadCompressedSpriteSheetOverrideBuffer(src, buffer); //Wasn't preloaded
+}
+
+//Decompresses the mugshot sheets one per frame while the trainer walks over,
+//so the transition itself only has to copy them into VRAM
+static void Task_PreloadMugshots(u8 taskId)
+{
+	struct Task* task = &gTasks[taskId];
+
+	switch (task->tState) {
+		case 0: //Opponent A
+			PreloadMugshotSpriteSheet(GetFrontierTrainerFrontSpriteId(gTrainerBattleOpponent_A, 0), FALSE, 0);
+			break;
+		case 1: //Opponent B
+			if (IsTrainerBattleModeAgainstTwoOpponents())
+				PreloadMugshotSpriteSheet(GetFrontierTrainerFrontSpriteId(VarGet(VAR_SECOND_OPPONENT), 1), FALSE, 1);
+			break;
+		case 2: //Player
+			PreloadMugshotSpriteSheet(PlayerGenderToFrontTrainerPicId(gSaveBlock2->playerGender, TRUE), TRUE, 2);
+			break;
+		default:
+			DestroyTask(taskId);
+			return;
+	}
+
+	task->tState++;
+}
+
+//Same check GetTrainerBattleTransition uses to pick the mugshot transition
+static bool8 TrainerBattleUsesMugshots(void)
+{
+	#ifdef TUTORIAL_BATTLES
+	return Var8000 == 0xFEFE && sTrainerEventObjectLocalId != 0;
+	#else
+	return sTrainerEventObjectLocalId != 0;
+	#endif
+}
+
+void StartMugshotPreload(void)
+{
+	ClearMugshotPreload();
+
+	if (TrainerBattleUsesMugshots()) //Regular trainers don't show any mugshots
+		CreateTask(Task_PreloadMugshots, 0xFF);
+}
+
+void ClearMugshotPreload(void)
+{
+	u8 taskId = FindTaskIdByFunc(Task_PreloadMugshots);
+	if (taskId != 0xFF)
+		DestroyTask(taskId);
+
+	if (sMugshotPreload->built == MUGSHOT_PRELOAD_MAGIC)
+	{
+		for (u32 i = 0; i < MUGSHOT_PRELOAD_COUNT; ++i)
+			Free(sMugshotPreload->entries[i].data);
+	}
+
+	Memset(sMugshotPreload, 0, sizeof(struct MugshotPreload));
+	sMugshotPreload->built = MUGSHOT_PRELOAD_MAGIC;
+}
+
 
 
 //Allow for second trainer in mugshot
@@ -31,26 +31,110 @@ ability_t GetBankAbility(u8 bank)
 	return gBattleMons[bank].ability;
 }
 
+static void AddAbilityCandidate(struct AbilityKnowledge* knowledge, u8 baseAbility, u16 species)
+{
+	u32 i;
+	u8 ability;
+
+	if (baseAbility == ABILITY_NONE) //Randomizing would give the empty slot an ability
+		return;
+
+	ability = TryRandomizeAbility(baseAbility, species);
+	for (i = 0; i < NUM_ABILITY_CANDIDATES; ++i)
+	{
+		if (knowledge->candidates[i] == ability)
+			return; //Already listed
+
+		if (knowledge->candidates[i] == ABILITY_NONE)
+		{
+			knowledge->candidates[i] = ability;
+			return;
+		}
+	}
+}
+
+//The knowledge is rebuilt from the species the other side sees (the disguise
+//if Illusion is up) whenever it changes. If the ability changes without being
+//recorded, the message for it was on screen but the new ability may not have
+//been, so the species can no longer narrow it down.
+static struct AbilityKnowledge* GetAbilityKnowledge(u8 bank)
+{
+	struct AbilityKnowledge* knowledge = &gNewBS->abilityKnowledge[bank];
+	u16 species = (gStatuses3[bank] & STATUS3_ILLUSION) ? GetIllusionPartyData(bank)->species : SPECIES(bank);
+	u8 ability = CopyAbility(bank);
+
+	if (knowledge->species != species)
+	{
+		Memset(knowledge, 0, sizeof(struct AbilityKnowledge));
+		knowledge->species = species;
+		knowledge->lastAbility = ability;
+		AddAbilityCandidate(knowledge, gBaseStats[species].ability1, species);
+		AddAbilityCandidate(knowledge, gBaseStats[species].ability2, species);
+		AddAbilityCandidate(knowledge, gBaseStats[species].hiddenAbility, species);
+	}
+	else if (knowledge->lastAbility != ability)
+	{
+		knowledge->lastAbility = ability;
+		knowledge->revealed = ABILITY_NONE;
+		knowledge->speciesAbilityLost = TRUE;
+		knowledge->heldItemWorked = FALSE; //That was with the old ability
+	}
+
+	return knowledge;
+}
+
+static bool8 CouldHaveAbility(const struct AbilityKnowledge* knowledge, u8 ability)
+{
+	u32 i;
+
+	if (knowledge->revealed != ABILITY_NONE)
+		return knowledge->revealed == ability;
+
+	if (ability == ABILITY_KLUTZ && knowledge->heldItemWorked)
+		return FALSE;
+
+	if (knowledge->speciesAbilityLost)
+		return TRUE;
+
+	for (i = 0; i < NUM_ABILITY_CANDIDATES; ++i)
+	{
+		if (knowledge->candidates[i] == ability)
+			return TRUE;
+	}
+
+	return FALSE;
+}
+
 ability_t GetRecordedAbility(u8 bank)
 {
+	u32 i;
+	u8 known = ABILITY_NONE;
+	struct AbilityKnowledge* knowledge;
+
 	if (IsAbilitySuppressed(bank))
 		return ABILITY_NONE;
 
-	if (BATTLE_HISTORY->abilities[bank] != ABILITY_NONE)
-		return BATTLE_HISTORY->abilities[bank];
+	knowledge = GetAbilityKnowledge(bank);
 
-	u16 species = species;
-	u8 ability1 = TryRandomizeAbility(gBaseStats[species].ability1, species);
-	u8 ability2 = TryRandomizeAbility(gBaseStats[species].ability2, species);
-	u8 hiddenAbility = TryRandomizeAbility(gBaseStats[species].hiddenAbility, species);
+	if (knowledge->revealed != ABILITY_NONE)
+		return knowledge->revealed;
 
-	if (ability1 == ability2 && hiddenAbility == ABILITY_NONE)
-		return ability1;
+	if (knowledge->speciesAbilityLost)
+		return ABILITY_NONE; //We don't know which ability the target has
 
-	if (ability1 == ability2 && ability1 == hiddenAbility)
-		return ability1;
+	//Known if only one of the species' abilities hasn't been ruled out
+	for (i = 0; i < NUM_ABILITY_CANDIDATES && knowledge->candidates[i] != ABILITY_NONE; ++i)
+	{
+		if (CouldHaveAbility(knowledge, knowledge->candidates[i]))
+		{
+			if (known != ABILITY_NONE)
+				return ABILITY_NONE; //More than one is possible
 
-	return ABILITY_NONE; //We don't know which ability the target has
+			known = knowledge->candidates[i];
+		}
+	}
+
+	return known;
 }
 
 ability_t CopyAbility(u8 bank)
@@ -75,15 +159,18 @@ ability_t* GetAbilityLocation(u8 bank)
 
 void RecordAbilityBattle(u8 bank, u8 ability)
 {
-	BATTLE_HISTORY->abilities[bank] = ability;
+	struct AbilityKnowledge* knowledge = GetAbilityKnowledge(bank);
+
+	knowledge->revealed = ability;
+	knowledge->lastAbility = CopyAbility(bank); //The change that led to this is now known
 }
 
 void ClearBattlerAbilityHistory(u8 bank)
 {
-	BATTLE_HISTORY->abilities[bank] = ABILITY_NONE;
+	Memset(&gNewBS->abilityKnowledge[bank], 0, sizeof(struct AbilityKnowledge));
 }
 
-item_effect_t GetBankItemEffect(u8 bank)
+static item_effect_t CalcBankItemEffect(u8 bank)
 {
 	if (ABILITY(bank) != ABILITY_KLUTZ && !gNewBS->EmbargoTimers[bank] && !IsMagicRoomActive())
 		return ItemId_GetHoldEffect(ITEM(bank));
@@ -91,6 +178,101 @@ item_effect_t GetBankItemEffect(u8 bank)
 	return 0;
 }
 
+static bool8 CalcGrounding(u8 bank, u8 itemEffect)
+{
+	if (gStatuses3[bank] & STATUS3_IN_AIR)
+		return IN_AIR;
+
+	if (IsGravityActive()
+	|| itemEffect == ITEM_EFFECT_IRON_BALL
+	|| (gStatuses3[bank] & (STATUS3_SMACKED_DOWN | STATUS3_ROOTED)))
+		return GROUNDED;
+
+	else if ((gStatuses3[bank] & (STATUS3_LEVITATING | STATUS3_TELEKINESIS | STATUS3_IN_AIR))
+		   || itemEffect == ITEM_EFFECT_AIR_BALLOON
+		   || ABILITY(bank) == ABILITY_LEVITATE
+		   || gBattleMons[bank].type3 == TYPE_FLYING
+		   || gBattleMons[bank].type1 == TYPE_FLYING
+		   || gBattleMons[bank].type2 == TYPE_FLYING)
+				return IN_AIR;
+
+	return GROUNDED;
+}
+
+static u32 CalcTypeMask(u8 bank)
+{
+	u32 typeMask = 0;
+	u8 type1 = gBattleMons[bank].type1;
+	u8 type2 = gBattleMons[bank].type2;
+	u8 type3 = gBattleMons[bank].type3;
+
+	if (!IS_BLANK_TYPE(type1) && type1 < 32)
+		typeMask |= gBitTable[type1];
+
+	if (!IS_BLANK_TYPE(type2) && type2 < 32)
+		typeMask |= gBitTable[type2];
+
+	if (!IS_BLANK_TYPE(type3) && type3 < 32)
+		typeMask |= gBitTable[type3];
+
+	return typeMask;
+}
+
+#define STATUS3_ATTRIBUTE_CACHE_MASK (STATUS3_ABILITY_SUPPRESS | STATUS3_IN_AIR | STATUS3_SMACKED_DOWN | STATUS3_ROOTED | STATUS3_LEVITATING | STATUS3_TELEKINESIS)
+
+//The cached attributes are only valid while the battler data they were derived
+//from stays the same. That data is checked directly since it's written from far
+//too many places to be reliably invalidated. Field effects that change the
+//attributes call InvalidateBattlerAttributeCaches instead.
+static struct BattlerAttributeCache* GetBattlerAttributeCache(u8 bank)
+{
+	struct BattlerAttributeCache* cache = &gNewBS->attributeCache[bank];
+	u32 key0 = gBattleMons[bank].ability | (ITEM(bank) << 8) | ((gNewBS->EmbargoTimers[bank] != 0) << 24);
+	u32 key1 = gBattleMons[bank].type1 | (gBattleMons[bank].type2 << 8) | (gBattleMons[bank].type3 << 16);
+	u32 key2 = gStatuses3[bank] & STATUS3_ATTRIBUTE_CACHE_MASK;
+
+	if (!cache->valid || cache->key[0] != key0 || cache->key[1] != key1 || cache->key[2] != key2)
+	{
+		cache->key[0] = key0;
+		cache->key[1] = key1;
+		cache->key[2] = key2;
+		cache->itemEffect = CalcBankItemEffect(bank);
+		cache->grounding = CalcGrounding(bank, cache->itemEffect);
+		cache->typeMask = CalcTypeMask(bank);
+		cache->valid = TRUE;
+	}
+	#ifdef DEBUG_BATTLER_ATTRIBUTE_CACHE
+	else
+	{
+		u8 itemEffect = CalcBankItemEffect(bank);
+
+		if (cache->itemEffect != itemEffect
+		||  cache->grounding != CalcGrounding(bank, itemEffect)
+		||  cache->typeMask != CalcTypeMask(bank))
+		{
+			++gNewBS->attributeCacheMismatches; //Some event that changes these isn't invalidating the cache
+			cache->valid = FALSE;
+			return GetBattlerAttributeCache(bank);
+		}
+	}
+	#endif
+
+	return cache;
+}
+
+//Call whenever something that isn't part of the battler's own data changes
+//their item effect or grounding (eg. Gravity, Magic Room).
+void InvalidateBattlerAttributeCaches(void)
+{
+	for (u32 i = 0; i < MAX_BATTLERS_COUNT; ++i)
+		gNewBS->attributeCache[i].valid = FALSE;
+}
+
+item_effect_t GetBankItemEffect(u8 bank)
+{
+	return GetBattlerAttributeCache(bank)->itemEffect;
+}
+
 item_effect_t GetMonItemEffect(struct Pokemon* mon)
 {
 	if (GetMonAbility(mon) != ABILITY_KLUTZ && !IsMagicRoomActive())
@@ -115,6 +297,13 @@ void RecordItemEffectBattle(u8 bank, u8 itemEffect)
 	BATTLE_HISTORY->itemEffects[bank] = itemEffect;
 }
 
+//Only for held items that took effect and would have been stopped by Klutz.
+//Revealing an item (Frisk, Pickup) or using a Mega Stone or Z-Crystal says nothing about it.
+void RecordItemWorkedBattle(u8 bank)
+{
+	GetAbilityKnowledge(bank)->heldItemWorked = TRUE;
+}
+
 void ClearBattlerItemEffectHistory(u8 bank)
 {
 	BATTLE_HISTORY->itemEffects[bank] = 0;
@@ -174,23 +363,7 @@ u8 GetBankFromPartyData(struct Pokemon* mon)
 
 bool8 CheckGrounding(u8 bank)
 {
-	if (gStatuses3[bank] & STATUS3_IN_AIR)
-		return IN_AIR;
-
-	if (IsGravityActive()
-	|| GetBankItemEffect(bank) == ITEM_EFFECT_IRON_BALL
-	|| (gStatuses3[bank] & (STATUS3_SMACKED_DOWN | STATUS3_ROOTED)))
-		return GROUNDED;
-
-	else if ((gStatuses3[bank] & (STATUS3_LEVITATING | STATUS3_TELEKINESIS | STATUS3_IN_AIR))
-		   || ITEM_EFFECT(bank) == ITEM_EFFECT_AIR_BALLOON
-		   || ABILITY(bank) == ABILITY_LEVITATE
-		   || gBattleMons[bank].type3 == TYPE_FLYING
-		   || gBattleMons[bank].type1 == TYPE_FLYING
-		   || gBattleMons[bank].type2 == TYPE_FLYING)
-				return IN_AIR;
-
-	return GROUNDED;
+	return GetBattlerAttributeCache(bank)->grounding;
 }
 
 bool8 NonInvasiveCheckGrounding(u8 bank)
@@ -289,6 +462,9 @@ bool8 SheerForceCheck(void)
 
 bool8 IsOfType(u8 bank, u8 type)
 {
+	if (type < 32)
+		return (GetBattlerAttributeCache(bank)->typeMask & gBitTable[type]) != 0;
+
 	u8 type1 = gBattleMons[bank].type1;
 	u8 type2 = gBattleMons[bank].type2;
 	u8 type3 = gBattleMons[bank].type3;
@@ -448,56 +624,106 @@ u8 CountBoosts(u8 bank)
 	return sum;
 }
 
-u8 CheckMoveLimitations(u8 bank, u8 unusableMoves, u8 check)
+//Finds every reason each of the bank's moves can't be used. Callers then pick
+//out the reasons they care about with their MOVE_LIMITATION_* checks.
+static void CalcUsableMoveCache(u8 bank, struct UsableMoveCache* cache)
 {
 	u8 ability = ABILITY(bank);
 	u8 holdEffect = ITEM_EFFECT(bank);
 	u16 choicedMove = CHOICED_MOVE(bank);
+	bool8 dynamaxed = IsDynamaxed(bank);
+	bool8 tormented = IsTormented(bank);
+	bool8 taunted = IsTaunted(bank);
+	bool8 choiceLocked = !dynamaxed
+					  && (holdEffect == ITEM_EFFECT_CHOICE_BAND || ability == ABILITY_GORILLATACTICS)
+					  && choicedMove != 0 && choicedMove != 0xFFFF;
+	#ifdef FLAG_SKY_BATTLE
+	bool8 skyBattle = FlagGet(FLAG_SKY_BATTLE);
+	#endif
+	bool8 gravity = IsGravityActive();
+	bool8 cantUseSoundMoves = CantUseSoundMoves(bank);
+	bool8 healBlocked = IsHealBlocked(bank);
+	bool8 raidBanned = IsRaidBattle() && bank != GetBattlerAtPosition(B_POSITION_OPPONENT_LEFT);
 	int i;
 
-	gStringBank = bank;
+	Memset(cache, 0, sizeof(struct UsableMoveCache));
+
 	for (i = 0; i < MAX_MON_MOVES; ++i)
 	{
 		u16 move = gBattleMons[bank].moves[i];
-		if (move == 0 && check & MOVE_LIMITATION_ZEROMOVE)
-			unusableMoves |= gBitTable[i];
-		else if (gBattleMons[bank].pp[i] == 0 && check & MOVE_LIMITATION_PP)
-			unusableMoves |= gBitTable[i];
-		else if (!IsDynamaxed(bank) && move == gDisableStructs[bank].disabledMove && check & MOVE_LIMITATION_DISABLED)
-			unusableMoves |= gBitTable[i];
-		else if (move == gLastUsedMoves[bank] && check & MOVE_LIMITATION_TORMENTED && IsTormented(bank))
-			unusableMoves |= gBitTable[i];
-		else if (IsTaunted(bank) && check & MOVE_LIMITATION_TAUNT && SPLIT(move) == SPLIT_STATUS)
-			unusableMoves |= gBitTable[i];
-		else if (IsImprisoned(bank, move) && check & MOVE_LIMITATION_IMPRISION)
-			unusableMoves |= gBitTable[i];
-		else if (gDisableStructs[bank].encoreTimer && gDisableStructs[bank].encoredMove != move && check & MOVE_LIMITATION_ENCORE)
-			unusableMoves |= gBitTable[i];
-		else if (!IsDynamaxed(bank)
-			 && (holdEffect == ITEM_EFFECT_CHOICE_BAND || ability == ABILITY_GORILLATACTICS)
-			 && choicedMove != 0 && choicedMove != 0xFFFF && choicedMove != move
-			 && check & MOVE_LIMITATION_CHOICE)
-		{
-			unusableMoves |= gBitTable[i];
-		}
-		else if (holdEffect == ITEM_EFFECT_ASSAULT_VEST && SPLIT(move) == SPLIT_STATUS)
-			unusableMoves |= gBitTable[i];
+		u8 bit = gBitTable[i];
+
+		if (move == 0)
+			cache->movesByLimitation[0] |= bit; //MOVE_LIMITATION_ZEROMOVE
+		if (gBattleMons[bank].pp[i] == 0)
+			cache->movesByLimitation[1] |= bit; //MOVE_LIMITATION_PP
+		if (!dynamaxed && move == gDisableStructs[bank].disabledMove)
+			cache->movesByLimitation[2] |= bit; //MOVE_LIMITATION_DISABLED
+		if (tormented && move == gLastUsedMoves[bank])
+			cache->movesByLimitation[3] |= bit; //MOVE_LIMITATION_TORMENTED
+		if (taunted && SPLIT(move) == SPLIT_STATUS)
+			cache->movesByLimitation[4] |= bit; //MOVE_LIMITATION_TAUNT
+		if (IsImprisoned(bank, move))
+			cache->movesByLimitation[5] |= bit; //MOVE_LIMITATION_IMPRISION
+		if (choiceLocked && choicedMove != move)
+			cache->movesByLimitation[6] |= bit; //MOVE_LIMITATION_CHOICE
+		if (gDisableStructs[bank].encoreTimer && gDisableStructs[bank].encoredMove != move)
+			cache->movesByLimitation[7] |= bit; //MOVE_LIMITATION_ENCORE
+
+		if ((holdEffect == ITEM_EFFECT_ASSAULT_VEST && SPLIT(move) == SPLIT_STATUS)
 		#ifdef FLAG_SKY_BATTLE
-		else if (FlagGet(FLAG_SKY_BATTLE) && CheckTableForMove(move, gSkyBattleBannedMoves))
-			unusableMoves |= gBitTable[i];
+		|| (skyBattle && CheckTableForMove(move, gSkyBattleBannedMoves))
 		#endif
-		else if (IsGravityActive() && CheckTableForMove(move, gGravityBannedMoves))
-			unusableMoves |= gBitTable[i];
-		else if (CantUseSoundMoves(bank) && CheckSoundMove(move))
-			unusableMoves |= gBitTable[i];
-		else if (IsHealBlocked(bank) && CheckHealingMove(move))
-			unusableMoves |= gBitTable[i];
-		else if (IsRaidBattle() && bank != GetBattlerAtPosition(B_POSITION_OPPONENT_LEFT) && CheckTableForMove(move, gRaidBattleBannedMoves))
-			unusableMoves |= gBitTable[i];
+		|| (gravity && CheckTableForMove(move, gGravityBannedMoves))
+		|| (cantUseSoundMoves && CheckSoundMove(move))
+		|| (healBlocked && CheckHealingMove(move))
+		|| (raidBanned && CheckTableForMove(move, gRaidBattleBannedMoves)))
+			cache->alwaysUnusable |= bit;
 	}
+}
+
+//Nothing that affects which moves can be used changes while actions are being
+//chosen, so during action selection each bank's limitations are only found
+//once. The caches are cleared once the actions have all been picked.
+u8 CheckMoveLimitations(u8 bank, u8 unusableMoves, u8 check)
+{
+	struct UsableMoveCache tempCache;
+	struct UsableMoveCache* cache;
+	int i;
+
+	gStringBank = bank;
+
+	if (gBattleMainFunc == (u32) HandleTurnActionSelectionState)
+	{
+		cache = &gNewBS->usableMoveCache[bank];
+		if (!cache->valid)
+		{
+			CalcUsableMoveCache(bank, cache);
+			cache->valid = TRUE;
+		}
+	}
+	else
+	{
+		cache = &tempCache;
+		CalcUsableMoveCache(bank, cache);
+	}
+
+	unusableMoves |= cache->alwaysUnusable;
+	for (i = 0; i < NUM_MOVE_LIMITATIONS; ++i)
+	{
+		if (check & gBitTable[i])
+			unusableMoves |= cache->movesByLimitation[i];
+	}
+
 	return unusableMoves;
 }
 
+void InvalidateUsableMoveCaches(void)
+{
+	for (u32 i = 0; i < MAX_BATTLERS_COUNT; ++i)
+		gNewBS->usableMoveCache[i].valid = FALSE;
+}
+
 u8 CheckMoveLimitationsFromParty(struct Pokemon* mon, u8 unusableMoves, u8 check)
 {
 	u8 holdEffect = GetMonItemEffect(mon);
@@ -1036,8 +1262,8 @@ bool8 IsMockBattle(void)
 
 u8 CalcMoveSplit(u8 bank, u16 move)
 {
-	if (CheckTableForMove(move, gMovesThatChangePhysicality)
-	&&  SPLIT(move) != SPLIT_STATUS)
+	if (SPLIT(move) != SPLIT_STATUS //Cheaper check first
+	&&  CheckTableForMove(move, gMovesThatChangePhysicality))
 	{
 		u32 attack = gBattleMons[bank].attack;
 		u32 spAttack = gBattleMons[bank].spAttack;
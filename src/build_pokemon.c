@@ -98,6 +98,34 @@ struct Immunity
 	u8 type;
 };
 
+//The layout scripts give sp06A_GivePlayerFrontierMonByLoadedSpread, from before struct BattleTowerSpread was packed
+struct LegacyBattleTowerSpread
+{
+	u16 species;
+	u8 nature;
+	u8 ball;
+	u32 hpIv : 5;
+	u32 atkIv : 5;
+	u32 defIv : 5;
+	u32 spdIv : 5;
+	u32 spAtkIv : 5;
+	u32 spDefIv : 5;
+	u8 hpEv;
+	u8 atkEv;
+	u8 defEv;
+	u8 spdEv;
+	u8 spAtkEv;
+	u8 spDefEv;
+	u16 item;
+	u16 moves[MAX_MON_MOVES];
+	u8 specificTeamType;
+	u8 shiny : 1;
+	u8 forSingles : 1;
+	u8 forDoubles : 1;
+	u8 modifyMovesDoubles : 1;
+	u8 ability : 2;
+};
+
 static struct Immunity sImmunities[] =
 {
 	{NORMAL_IMMUNITY, TYPE_NORMAL},
@@ -459,10 +487,39 @@ u16 sp069_GivePlayerRandomFrontierMonByTier(void)
 
 u16 sp06A_GivePlayerFrontierMonByLoadedSpread(void)
 {
+	u32 i;
 	struct Pokemon mon;
-	struct BattleTowerSpread* spread = (struct BattleTowerSpread*) gLoadPointer;
-
-	CreateFrontierMon(&mon, Var8000, spread, 0, 0, 0, TRUE);
+	struct BattleTowerSpread spread;
+	const struct LegacyBattleTowerSpread* loaded = (const struct LegacyBattleTowerSpread*) gLoadPointer;
+
+	//Scripts lay the spread out by hand, so they still use the old unpacked layout
+	Memset(&spread, 0, sizeof(spread));
+	spread.species = loaded->species;
+	spread.nature = loaded->nature;
+	spread.ball = loaded->ball;
+	spread.hpIv = loaded->hpIv;
+	spread.atkIv = loaded->atkIv;
+	spread.defIv = loaded->defIv;
+	spread.spdIv = loaded->spdIv;
+	spread.spAtkIv = loaded->spAtkIv;
+	spread.spDefIv = loaded->spDefIv;
+	spread.hpEv = loaded->hpEv;
+	spread.atkEv = loaded->atkEv;
+	spread.defEv = loaded->defEv;
+	spread.spdEv = loaded->spdEv;
+	spread.spAtkEv = loaded->spAtkEv;
+	spread.spDefEv = loaded->spDefEv;
+	spread.item = loaded->item;
+	for (i = 0; i < MAX_MON_MOVES; ++i)
+		spread.moves[i] = loaded->moves[i];
+	spread.specificTeamType = loaded->specificTeamType;
+	spread.shiny = loaded->shiny;
+	spread.forSingles = loaded->forSingles;
+	spread.forDoubles = loaded->forDoubles;
+	spread.modifyMovesDoubles = loaded->modifyMovesDoubles;
+	spread.ability = loaded->ability;
+
+	CreateFrontierMon(&mon, Var8000, &spread, 0, 0, 0, TRUE);
 	return GiveMonToPlayer(&mon);
 }
 
@@ -3196,11 +3253,20 @@ void CreateBoxMon(struct BoxPokemon* boxMon, u16 species, u8 level, u8 fixedIV,
 	if (FlagGet(FLAG_POKEMON_RANDOMIZER) && !FlagGet(FLAG_BATTLE_FACILITY)) //Don't randomize in battle facilities
 	{
 		u32 id = MathMax(1, T1_READ_32(gSaveBlock2->playerTrainerId)); //0 id would mean every Pokemon would crash the game
-		u32 newSpecies = species * id;
-		species = MathMax(1, newSpecies % NUM_SPECIES);
+		u32 newSpecies = species;
+		u32 tries = 0;
+
+		do
+		{
+			newSpecies = MathMax(1, (newSpecies * id) % NUM_SPECIES);
+		} while (CheckTableForSpecies(newSpecies, gRandomizerSpeciesBanList) && ++tries < 10);
+
+		//The multiplier can cycle through only banned species, so step to the next allowed one instead
+		for (tries = 1; tries < NUM_SPECIES && CheckTableForSpecies(newSpecies, gRandomizerSpeciesBanList); ++tries)
+			newSpecies = (newSpecies % (NUM_SPECIES - 1)) + 1; //Wrap around to 1
 
-		while (CheckTableForSpecies(species, gRandomizerSpeciesBanList))
-			species *= id;
+		if (!CheckTableForSpecies(newSpecies, gRandomizerSpeciesBanList))
+			species = newSpecies;
 	}
 #endif
 
@@ -3461,6 +3527,25 @@ void CalculateMonStatsNew(struct Pokemon *mon)
 	SetMonData(mon, MON_DATA_HP, &currentHP);
 }
 
+#ifdef FLAG_ABILITY_RANDOMIZER
+#define RANDOMIZED_ABILITY_CACHE_SIZE 32 //Must be a power of 2
+#define RANDOMIZED_ABILITY_CACHE_BUILT 0x52414243 //"RABC"
+
+struct RandomizedAbilityCache
+{
+	u32 built; //RANDOMIZED_ABILITY_CACHE_BUILT once the entries have been cleared
+	u32 trainerId; //The mapping depends on it, so a different save clears the cache
+	struct
+	{
+		u16 species; //0xFFFF for an empty entry
+		u8 ability;
+		u8 randomized;
+	} entries[RANDOMIZED_ABILITY_CACHE_SIZE];
+};
+
+#define sRandomizedAbilityCache ((struct RandomizedAbilityCache*) 0x203F290)
+#endif
+
 u8 TryRandomizeAbility(u8 ability, unusedArg u16 species)
 {
 	u32 newAbility = ability;
@@ -3468,7 +3553,24 @@ u8 TryRandomizeAbility(u8 ability, unusedArg u16 species)
 	#ifdef FLAG_ABILITY_RANDOMIZER
 	if (FlagGet(FLAG_ABILITY_RANDOMIZER) && !FlagGet(FLAG_BATTLE_FACILITY))
 	{
-		u32 id = MathMax(1, T1_READ_32(gSaveBlock2->playerTrainerId)); //0 id would mean Pokemon wouldn't have ability
+		u32 i;
+		u32 trainerId = T1_READ_32(gSaveBlock2->playerTrainerId);
+		u32 id = MathMax(1, trainerId); //0 id would mean Pokemon wouldn't have ability
+		struct RandomizedAbilityCache* cache = sRandomizedAbilityCache;
+
+		if (cache->built != RANDOMIZED_ABILITY_CACHE_BUILT || cache->trainerId != trainerId)
+		{
+			for (i = 0; i < RANDOMIZED_ABILITY_CACHE_SIZE; ++i)
+				cache->entries[i].species = 0xFFFF;
+
+			cache->trainerId = trainerId;
+			cache->built = RANDOMIZED_ABILITY_CACHE_BUILT;
+		}
+
+		//GetMonAbility is called constantly, so remember the last few results
+		i = (species ^ (ability << 3)) & (RANDOMIZED_ABILITY_CACHE_SIZE - 1);
+		if (cache->entries[i].species == species && cache->entries[i].ability == ability)
+			return cache->entries[i].randomized;
 
 		do
 		{
@@ -3476,6 +3578,10 @@ u8 TryRandomizeAbility(u8 ability, unusedArg u16 species)
 			newAbility = MathMax(1, newAbility % ABILITIES_COUNT);
 		}
 		while (CheckTableForAbility(newAbility, gRandomizerAbilityBanList));
+
+		cache->entries[i].species = species;
+		cache->entries[i].ability = ability;
+		cache->entries[i].randomized = newAbility;
 	}
 	#endif
 
@@ -48,8 +48,31 @@ extern const u8 gText_CantCatchPokemonRightNow[];
 
 extern species_t gUltraBeastList[];
 
+//Shake check threshold for each catch rate below 0xFF: 0xFFFF0 / Sqrt(Sqrt(0xFF0000 / odds))
+//Odds of 0 (eg. Ultra Beasts in regular balls) never shake, same as the division by zero used to give
+static const u16 sShakeThresholds[0xFF] =
+{
+	0x0000, 0x4103, 0x4D48, 0x5555, 0x5B05, 0x6185, 0x6666, 0x6906, 0x6BC9, 0x71C6, 0x7506, 0x7506, 0x7878, 0x7C1E, 0x7C1E, 0x7FFF,
+	0x8420, 0x8420, 0x8420, 0x8888, 0x8888, 0x8D3D, 0x8D3D, 0x8D3D, 0x9248, 0x9248, 0x9248, 0x9248, 0x97B3, 0x97B3, 0x97B3, 0x97B3,
+	0x9D89, 0x9D89, 0x9D89, 0x9D89, 0x9D89, 0xA3D6, 0xA3D6, 0xA3D6, 0xA3D6, 0xA3D6, 0xA3D6, 0xAAAA, 0xAAAA, 0xAAAA, 0xAAAA, 0xAAAA,
+	0xAAAA, 0xAAAA, 0xAAAA, 0xB215, 0xB215, 0xB215, 0xB215, 0xB215, 0xB215, 0xB215, 0xB215, 0xB215, 0xBA2D, 0xBA2D, 0xBA2D, 0xBA2D,
+	0xBA2D, 0xBA2D, 0xBA2D, 0xBA2D, 0xBA2D, 0xBA2D, 0xBA2D, 0xBA2D, 0xC30B, 0xC30B, 0xC30B, 0xC30B, 0xC30B, 0xC30B, 0xC30B, 0xC30B,
+	0xC30B, 0xC30B, 0xC30B, 0xC30B, 0xC30B, 0xC30B, 0xCCCC, 0xCCCC, 0xCCCC, 0xCCCC, 0xCCCC, 0xCCCC, 0xCCCC, 0xCCCC, 0xCCCC, 0xCCCC,
+	0xCCCC, 0xCCCC, 0xCCCC, 0xCCCC, 0xCCCC, 0xCCCC, 0xCCCC, 0xCCCC, 0xCCCC, 0xD793, 0xD793, 0xD793, 0xD793, 0xD793, 0xD793, 0xD793,
+	0xD793, 0xD793, 0xD793, 0xD793, 0xD793, 0xD793, 0xD793, 0xD793, 0xD793, 0xD793, 0xD793, 0xD793, 0xD793, 0xD793, 0xD793, 0xD793,
+	0xD793, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D,
+	0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D, 0xE38D,
+	0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0,
+	0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0,
+	0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xF0F0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+};
+
 //This file's functions:
 static u8 GetCatchingBattler(void);
+static u16 GetCaughtDexCount(void);
 static bool8 CriticalCapture(u32 odds);
 
 void atkEF_handleballthrow(void)
@@ -296,7 +319,7 @@ void atkEF_handleballthrow(void)
 		#ifndef NO_HARDER_WILD_DOUBLES
 		if (!(gBattleTypeFlags & BATTLE_TYPE_TRAINER) && IS_DOUBLE_BATTLE)
 		{
-			u16 PokesCaught = GetNationalPokedexCount(FLAG_GET_CAUGHT);
+			u16 PokesCaught = GetCaughtDexCount();
 			if (PokesCaught < 30)
 				odds = (odds * 30) / 100;
 			else if (PokesCaught <= 150)
@@ -356,7 +379,7 @@ void atkEF_handleballthrow(void)
 				shakes = maxShakes;
 			else
 			{
-				odds = udivsi(0xFFFF0, Sqrt(Sqrt(udivsi(0xFF0000, odds))));
+				odds = sShakeThresholds[odds];
 				for (shakes = 0; shakes < maxShakes && Random() < odds; ++shakes) ;
 			}
 
@@ -410,13 +433,22 @@ static u8 GetCatchingBattler(void)
 	return battler;
 }
 
+//The count can't change until the battle ends, so only scan the dex flags once
+static u16 GetCaughtDexCount(void)
+{
+	if (gNewBS->caughtDexCount == 0)
+		gNewBS->caughtDexCount = GetNationalPokedexCount(FLAG_GET_CAUGHT) + 1;
+
+	return gNewBS->caughtDexCount - 1;
+}
+
 static bool8 CriticalCapture(u32 odds)
 {
 	#ifndef CRITICAL_CAPTURE
 		odds += 1; //So the compiler doesn't complain
 		return FALSE;
 	#else
-	u16 PokesCaught = GetNationalPokedexCount(FLAG_GET_CAUGHT);
+	u16 PokesCaught = GetCaughtDexCount();
 	if (PokesCaught <= 30)
 		odds = 0;
 	else if (PokesCaught <= 150)
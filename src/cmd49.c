@@ -98,6 +98,10 @@ enum
 	Force_Switch_Red_Card
 };
 
+//This file's functions:
+static bool8 SynchronizeCanActivate(u8 bank);
+static bool8 StatusImmunityAbilitiesCanActivate(void);
+
 void atk49_moveend(void) //All the effects that happen after a move is used
 {
 	int i;
@@ -270,7 +274,8 @@ void atk49_moveend(void) //All the effects that happen after a move is used
 			break;
 
 		case ATK49_SYNCHRONIZE_TARGET: // target synchronize
-			if (gCurrentMove != MOVE_PSYCHOSHIFT || !MOVE_HAD_EFFECT) //The lazy way of taking care of Psycho Shift Status Transfer->Synchronize->Heal Status
+			if ((gCurrentMove != MOVE_PSYCHOSHIFT || !MOVE_HAD_EFFECT) //The lazy way of taking care of Psycho Shift Status Transfer->Synchronize->Heal Status
+			&& SynchronizeCanActivate(gBankTarget))
 			{
 				if (AbilityBattleEffects(ABILITYEFFECT_SYNCHRONIZE, gBankTarget, 0, 0, 0))
 					effect = TRUE;
@@ -295,7 +300,8 @@ void atk49_moveend(void) //All the effects that happen after a move is used
 
 		case ATK49_SYNCHRONIZE_ATTACKER: // attacker synchronize
 		case ATK49_SYNCHRONIZE_ATTACKER_2:
-			if (AbilityBattleEffects(ABILITYEFFECT_SYNCHRONIZE, gBankAttacker, 0, 0, 0))
+			if (SynchronizeCanActivate(gBankAttacker)
+			&& AbilityBattleEffects(ABILITYEFFECT_SYNCHRONIZE, gBankAttacker, 0, 0, 0))
 				effect = TRUE;
 			gBattleScripting->atk49_state++;
 			break;
@@ -536,7 +542,8 @@ void atk49_moveend(void) //All the effects that happen after a move is used
 			break;
 
 		case ATK49_STATUS_IMMUNITY_ABILITIES: // status immunities
-			if (AbilityBattleEffects(ABILITYEFFECT_IMMUNITY, 0, 0, 0, 0))
+			if (StatusImmunityAbilitiesCanActivate()
+			&& AbilityBattleEffects(ABILITYEFFECT_IMMUNITY, 0, 0, 0, 0))
 				effect = TRUE; // it loops through all battlers, so we increment after its done with all battlers
 			else
 				gBattleScripting->atk49_state++;
@@ -1505,3 +1512,27 @@ void SortBanksBySpeed(u8 banks[], bool8 slowToFast)
 		speeds[j + 1] = key;
 	}
 }
+
+//The stages below run after every hit, so these are checked first to skip the
+//setup in AbilityBattleEffects when nothing can activate.
+static bool8 SynchronizeCanActivate(u8 bank)
+{
+	return gNewBS->synchronizeTarget[bank] != 0
+		|| gNewBS->skipCertainSwitchInAbilities; //AbilityBattleEffects still needs to clear this
+}
+
+static bool8 StatusImmunityAbilitiesCanActivate(void)
+{
+	if (gNewBS->skipCertainSwitchInAbilities)
+		return TRUE;
+
+	for (u32 i = 0; i < gBattlersCount; ++i)
+	{
+		if (gBattleMons[i].status1 != 0
+		||  gBattleMons[i].status2 & (STATUS2_CONFUSION | STATUS2_INFATUATION)
+		||  gDisableStructs[i].tauntTimer != 0)
+			return TRUE;
+	}
+
+	return FALSE;
+}
@@ -10,6 +10,8 @@
 //#define DEBUG_HMS //HMs can always be used from the party screen, Surf, Waterfall, and Rock Climb can always be used
 //#define DEBUG_OBEDIENCE //Traded Pokemon never have obedience issues
 //#define DEBUG_DYNAMAX //Dynamax can be used in Dynamax battles without a Dynamax Band
+//#define DEBUG_BATTLER_ATTRIBUTE_CACHE //Cached item effects, grounding, and types are checked against freshly calculated ones
+//#define INPUT_RECORDING //Special 0xCD can record the player's key presses and replay them later (also replaces the vanilla special 0xCD)
 
 /*===== General Vars =====*/
 #define VAR_TERRAIN 0x5000 //Set to a terrain type for a battle to begin with the given terrain
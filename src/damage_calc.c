@@ -617,6 +617,7 @@ void atk06_typecalc(void)
 				gLastLandedMoves[gBankTarget] = 0;
 				gLastHitByType[gBankTarget] = 0;
 				RecordItemEffectBattle(gBankTarget, defEffect);
+				RecordItemWorkedBattle(gBankTarget);
 			}
 			else if (gStatuses3[gBankTarget] & (STATUS3_LEVITATING | STATUS3_TELEKINESIS))
 			{
@@ -646,6 +647,7 @@ void atk06_typecalc(void)
 				gLastLandedMoves[gBankTarget] = 0;
 				gLastHitByType[gBankTarget] = 0xFF;
 				RecordItemEffectBattle(gBankTarget, defEffect);
+				RecordItemWorkedBattle(gBankTarget);
 			}
 			else if (IsOfType(gBankTarget, TYPE_GRASS))
 			{
@@ -712,6 +714,7 @@ void atk4A_typecalc2(void)
 			gMoveResultFlags |= (MOVE_RESULT_DOESNT_AFFECT_FOE);
 			gLastLandedMoves[gBankTarget] = 0;
 			RecordItemEffectBattle(gBankTarget, defEffect);
+			RecordItemWorkedBattle(gBankTarget);
 		}
 		else if (gStatuses3[gBankTarget] & (STATUS3_LEVITATING | STATUS3_TELEKINESIS))
 		{
@@ -736,6 +739,7 @@ void atk4A_typecalc2(void)
 			gMoveResultFlags |= (MOVE_RESULT_DOESNT_AFFECT_FOE);
 			gLastLandedMoves[gBankTarget] = 0;
 			RecordItemEffectBattle(gBankTarget, defEffect);
+			RecordItemWorkedBattle(gBankTarget);
 		}
 		else if (IsOfType(gBankTarget, TYPE_GRASS))
 		{
@@ -1627,11 +1631,13 @@ void AdjustDamage(bool8 CheckFalseSwipe)
 	else if (hold_effect == ITEM_EFFECT_FOCUS_BAND && umodsi(Random(), 100) < quality && !IsBankHoldingFocusSash(gBankTarget))
 	{
 		RecordItemEffectBattle(gBankTarget, hold_effect);
+		RecordItemWorkedBattle(gBankTarget);
 		gSpecialStatuses[gBankTarget].focusBanded = 1;
 	}
 	else if (IsBankHoldingFocusSash(gBankTarget) && BATTLER_MAX_HP(gBankTarget))
 	{
 		RecordItemEffectBattle(gBankTarget, hold_effect);
+		RecordItemWorkedBattle(gBankTarget);
 		gSpecialStatuses[gBankTarget].focusBanded = 1;
 		gNewBS->EnduranceHelper = ENDURE_FOCUS_SASH;
 	}
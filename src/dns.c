@@ -18,8 +18,6 @@ dns.c
 typedef bool8 IgnoredPalT[16];
 #define gIgnoredDNSPalIndices ((IgnoredPalT*) 0x203B830)
 
-static const u8 sDaysInAMonth[] = {0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-
 //This file's functions:
 static void FadeDayNightPalettes();
 static void BlendFadedPalettes(u32 selectedPalettes, u8 coeff, u32 color);
@@ -27,9 +25,7 @@ static void BlendFadedPalette(u16 palOffset, u16 numEntries, u8 coeff, u32 blend
 static u16 FadeColourForDNS(struct PlttData* blend, u8 coeff, s8 r, s8 g, s8 b);
 static void FadeOverworldBackground(u32 selectedPalettes, u8 coeff, u32 color, bool8 palFadeActive);
 static bool8 IsDate1BeforeDate2(u32 y1, u32 m1, u32 d1, u32 y2, u32 m2, u32 d2);
-static bool8 IsLeapYear(u32 year);
-static bool8 IsLastDayInMonth(u32 year, u8 month, u8 day);
-static void IncreaseDateByOneDay(u32* year, u8* month, u8* day);
+static u32 GetDaysSinceEpoch(u32 year, u8 month, u8 day);
 
 void TransferPlttBuffer(void)
 {	
@@ -356,41 +352,26 @@ static bool8 IsDate1BeforeDate2(u32 y1, u32 m1, u32 d1, u32 y2, u32 m2, u32 d2)
 	return y1 < y2 ? TRUE : (y1 == y2 ? (m1 < m2 ? TRUE : (m1 == m2 ? d1 < d2 : FALSE)) : FALSE);
 }
 
-static bool8 IsLeapYear(u32 year)
+//Counts days in the proleptic Gregorian calendar. Years are shifted to start
+//in March so the leap day is the last day of the year, and 400 years are added
+//so January and February of year 0 don't go negative. Only differences
+//between two results are meaningful.
+static u32 GetDaysSinceEpoch(u32 year, u8 month, u8 day)
 {
-	return (year % 4 == 0) && ((year % 100 != 0) || (year % 400 == 0));
-}
+	u32 era, yearOfEra, dayOfYear, dayOfEra;
 
-static bool8 IsLastDayInMonth(u32 year, u8 month, u8 day)
-{
-	if (month == 0 || month > 12)
-		return FALSE;
+	if (month == 0)
+		month = 1;
+	else if (month > 12)
+		month = 12;
 
-	else if (month == 2)
-		return IsLeapYear(year) ? (day == 29) : (day == 28);
+	year += 400 - (month <= 2);
+	era = year / 400;
+	yearOfEra = year - era * 400; //[0, 399]
+	dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1; //[0, 365]
+	dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear; //[0, 146096]
 
-	else
-		return sDaysInAMonth[month] == day;
-}
-
-static void IncreaseDateByOneDay(u32* year, u8* month, u8* day)
-{
-	if (IsLastDayInMonth(*year, *month, *day))
-	{
-		if (*month == 12) //IsLastMonthInYear
-		{
-			*month = 1;
-			*day = 1;
-			++*year;
-		}
-		else
-		{
-			*day = 1;
-			++*month;
-		}
-	}
-	else
-		++*day;
+	return era * 146097 + dayOfEra;
 }
 
 u32 GetMinuteDifference(u32 startYear, u8 startMonth, u8 startDay, u8 startHour, u8 startMin, u32 endYear, u8 endMonth, u8 endDay, u8 endHour, u8 endMin)
@@ -438,24 +419,16 @@ u32 GetHourDifference(u32 startYear, u8 startMonth, u8 startDay, u8 startHour, u
 
 u32 GetDayDifference(u32 startYear, u8 startMonth, u8 startDay, u32 endYear, u8 endMonth, u8 endDay)
 {
-	u32 days = 0;
-
 	if (startYear == 0 && endYear >= 2018) //Player recently activated their clock
-	{ //Save time and skip ahead
-		days = 737060;
-		startYear = 2018;
+	{ //Count from the start of year 0
 		startMonth = 1;
 		startDay = 1;
 	}
 
-	//Increment until current date is reached
-	while (IsDate1BeforeDate2(startYear, startMonth, startDay, endYear, endMonth, endDay) && days < 0xFFFFFFFF)
-	{
-		++days;
-		IncreaseDateByOneDay(&startYear, &startMonth, &startDay); /* works on year, month and day variables */
-	}
+	if (!IsDate1BeforeDate2(startYear, startMonth, startDay, endYear, endMonth, endDay))
+		return 0;
 
-	return days;
+	return GetDaysSinceEpoch(endYear, endMonth, endDay) - GetDaysSinceEpoch(startYear, startMonth, startDay);
 }
 
 u32 GetMonthDifference(u32 startYear, u8 startMonth, u32 endYear, u8 endMonth)
@@ -482,15 +455,8 @@ u32 GetYearDifference(u32 startYear, u32 endYear)
 /* Test Cases
 int main()
 {
-	u8 dayToIncrease = 31;
-	u8 monthToIncrease = 12;
-	u32 yearToIncrease = 2019;
-	IncreaseDateByOneDay(&yearToIncrease, &monthToIncrease, &dayToIncrease);
-
-	printf("Date 1 Before Date 2: %d\n", IsDate1BeforeThanDate2(2019, 12, 31, 2019, 05, 30));
-	printf("Is %d a Leap Year: %d\n", 2020, IsLeapYear(2020));
-	printf("Is last day in month: %d\n", IsLastDayInMonth(2020, 02, 29));
-	printf("New Year: %d, New Month: %d, New Day: %d\n", yearToIncrease, monthToIncrease, dayToIncrease);
+	printf("Date 1 Before Date 2: %d\n", IsDate1BeforeDate2(2019, 12, 31, 2019, 05, 30));
+	printf("Days in 2020: %d\n", GetDaysSinceEpoch(2021, 01, 01) - GetDaysSinceEpoch(2020, 01, 01)); //366
 
 	printf("06-15-2000 @00:00 to 05-01-2018 @00:00\n");
 	printf("Year difference: %d\n", GetYearDifference(2000, 2018)); //18
@@ -33,32 +33,132 @@ struct PalRef
 	u16 PalTag;
 };
 
+struct PalRefCache
+{
+	u32 hash[16];		//Hash of the colours loaded into each NPC slot
+	u16 lastUsed[16];	//Clock value when each slot was last requested
+	u16 releasedSlots;	//Slots no longer referenced whose palette is still loaded
+	u16 clock;
+	struct PalRefStats stats;
+};
+
 #define sPalRefs ((struct PalRef*) 0x203B7D4) //Make sure to change reference in BT scripts if modified
+#define sPalRefCache ((struct PalRefCache*) 0x203F000)
+
+#define NPC_PAL_SCRATCH_SLOT 15
 
 //This file's functions:
 static u16 TintColor(u16 color);
 static u8 GetPalTypeByPalTag(u16 palTag);
 static u8 FindPalTag(u16 PalTag);
 static u8 PalRefIncreaseCount(u8 palSlot);
+static void TouchPalRef(u8 palSlot);
+static void ClaimPalRef(u8 palSlot, u8 type, u16 palTag);
+static u8 FindLeastRecentlyUsedReleasedPalRef(void);
+static u8 CountPalRefsInUse(void);
+static void ReadNPCPalette(u16 palTag, u16* colours);
+static u32 HashPalette(const u16* colours);
+static u8 FindNPCPaletteWithSameColours(const u16* colours, u32 hash);
 static void BrightenReflection(u8 palSlot);
 static u8 AddPalTag(u16 palTag);
 static void MaskPaletteIfFadingIn(u8 palSlot);
 
 u8 AddPalRef(u8 type, u16 palTag)
 {
-	for (int i = 0; i < 16; i++)
+	int i;
+
+	for (i = 0; i < 16; i++) //Pick up this palette again if it was released but never evicted
+	{
+		if (sPalRefCache->releasedSlots & gBitTable[i]
+		&& sPalRefs[i].Type == type && sPalRefs[i].PalTag == palTag)
+		{
+			ClaimPalRef(i, type, palTag);
+			return i;
+		}
+	}
+
+	for (i = 0; i < 16; i++)
 	{
 		if (sPalRefs[i].Type == PalTypeUnused)
 		{
-			sPalRefs[i].Type = type;
-			sPalRefs[i].PalTag = palTag;
+			ClaimPalRef(i, type, palTag);
 			return i;
 		}
 	}
 
+	i = FindLeastRecentlyUsedReleasedPalRef();
+	if (i != 0xFF)
+	{
+		++sPalRefCache->stats.evictions;
+		ClaimPalRef(i, type, palTag);
+		return i;
+	}
+
+	++sPalRefCache->stats.overflows;
 	return 0xFF; //No more space
 }
 
+static void ClaimPalRef(u8 palSlot, u8 type, u16 palTag)
+{
+	u8 inUse;
+
+	sPalRefs[palSlot].Type = type;
+	sPalRefs[palSlot].Count = 0;
+	sPalRefs[palSlot].PalTag = palTag;
+	sPalRefCache->hash[palSlot] = 0;
+	TouchPalRef(palSlot);
+
+	inUse = CountPalRefsInUse();
+	if (inUse > sPalRefCache->stats.peakSlotsInUse)
+		sPalRefCache->stats.peakSlotsInUse = inUse;
+}
+
+static void TouchPalRef(u8 palSlot)
+{
+	sPalRefCache->releasedSlots &= ~gBitTable[palSlot];
+	sPalRefCache->lastUsed[palSlot] = ++sPalRefCache->clock;
+}
+
+static u8 FindLeastRecentlyUsedReleasedPalRef(void)
+{
+	u8 lruSlot = 0xFF;
+	u16 oldestAge = 0;
+
+	for (int i = 0; i < 16; ++i)
+	{
+		if (sPalRefCache->releasedSlots & gBitTable[i] && sPalRefs[i].Type != PalTypeUnused)
+		{
+			u16 age = sPalRefCache->clock - sPalRefCache->lastUsed[i]; //Unsigned so the clock can wrap around
+			if (lruSlot == 0xFF || age > oldestAge)
+			{
+				lruSlot = i;
+				oldestAge = age;
+			}
+		}
+	}
+
+	return lruSlot;
+}
+
+static u8 CountPalRefsInUse(void)
+{
+	u8 count = 0;
+
+	for (int i = 0; i < 16; ++i)
+	{
+		if (sPalRefs[i].Type != PalTypeUnused && !(sPalRefCache->releasedSlots & gBitTable[i]))
+			++count;
+	}
+
+	return count;
+}
+
+const struct PalRefStats* GetPalRefStats(void)
+{
+	sPalRefCache->stats.slotsInUse = CountPalRefsInUse();
+	return &sPalRefCache->stats;
+}
+
 u8 FindPalRef(u8 type, u16 palTag)
 {
 	for (int i = 0; i < 16; i++)
@@ -174,6 +274,7 @@ u8 FindPalette(u16 palTag) //Hook at 0x80089E8 via r1
 static u8 PalRefIncreaseCount(u8 palSlot)
 {
 	sPalRefs[palSlot].Count++;
+	TouchPalRef(palSlot);
 	return palSlot;
 }
 
@@ -181,17 +282,15 @@ void PalRefDecreaseCount(u8 palSlot)
 {
 	if (sPalRefs[palSlot].Count != 0)
 		sPalRefs[palSlot].Count--;
-	if (sPalRefs[palSlot].Count == 0)
-	{
-		sPalRefs[palSlot].Type = 0;
-		sPalRefs[palSlot].PalTag = 0;
-	}
+	if (sPalRefs[palSlot].Count == 0) //Leave the palette loaded until the slot is needed for something else
+		sPalRefCache->releasedSlots |= gBitTable[palSlot];
 }
 
 void ClearAllPalRefs(void)
 {
 	int fill = 0;
 	CpuSet(&fill, sPalRefs, 32 | CpuSetFill);
+	Memset(sPalRefCache, 0, sizeof(struct PalRefCache)); //Stats are per map
 }
 
 void ClearAllPalettes(void) //Hook at 0x5F574 via r0
@@ -247,11 +346,17 @@ u8 FindOrLoadPalette(struct SpritePalette* pal) //Hook at 0x8928 via r1
 	{
 		palSlot = FindPalRef(GetPalTypeByPalTag(palTag), palTag);
 		if (palSlot != 0xFF)
+		{
+			++sPalRefCache->stats.residentHits;
+			TouchPalRef(palSlot);
 			return palSlot;
+		}
 
 		palSlot = AddPalRef(GetPalTypeByPalTag(palTag), palTag);
 		if (palSlot == 0xFF)
 			return 0xFF;
+
+		++sPalRefCache->stats.loads;
 	}
 	else
 	{
@@ -305,17 +410,83 @@ u8 GetPalSlotMisc(u32 OBJData)
 	return PalRefIncreaseCount(palSlot);
 }
 
+static void ReadNPCPalette(u16 palTag, u16* colours)
+{
+	u16 offset = 16 * 16 + NPC_PAL_SCRATCH_SLOT * 16;
+	u16 unfadedBackup[16];
+	u16 fadedBackup[16];
+
+	//The NPC palette table is only reachable through the vanilla loader, so borrow a slot and put it back
+	CpuCopy16(&gPlttBufferUnfaded[offset], unfadedBackup, 16 * sizeof(u16));
+	CpuCopy16(&gPlttBufferFaded[offset], fadedBackup, 16 * sizeof(u16));
+	LoadNPCPalette(palTag, NPC_PAL_SCRATCH_SLOT);
+	CpuCopy16(&gPlttBufferUnfaded[offset], colours, 16 * sizeof(u16));
+	CpuCopy16(unfadedBackup, &gPlttBufferUnfaded[offset], 16 * sizeof(u16));
+	CpuCopy16(fadedBackup, &gPlttBufferFaded[offset], 16 * sizeof(u16));
+}
+
+static u32 HashPalette(const u16* colours)
+{
+	u32 hash = 2166136261; //FNV-1a
+
+	for (int i = 0; i < 16; ++i)
+	{
+		hash ^= colours[i];
+		hash *= 16777619;
+	}
+
+	return hash | 1; //0 means the slot hasn't been hashed
+}
+
+static u8 FindNPCPaletteWithSameColours(const u16* colours, u32 hash)
+{
+	u16 loadedColours[16];
+
+	for (int i = 0; i < 16; ++i)
+	{
+		if (sPalRefs[i].Type == PalTypeNPC && sPalRefCache->hash[i] == hash)
+		{
+			int j;
+			ReadNPCPalette(sPalRefs[i].PalTag, loadedColours); //Rule out hash collisions
+
+			for (j = 0; j < 16 && loadedColours[j] == colours[j]; ++j);
+
+			if (j == 16)
+				return i;
+		}
+	}
+
+	return 0xFF;
+}
+
 u8 FindOrLoadNPCPalette(u16 palTag)
 {
+	u32 hash;
+	u16 colours[16];
 	u8 palSlot = FindPalRef(PalTypeNPC, palTag);
 	if (palSlot != 0xFF)
+	{
+		++sPalRefCache->stats.residentHits;
+		return PalRefIncreaseCount(palSlot);
+	}
+
+	//Different tags with identical colours can share a slot
+	ReadNPCPalette(palTag, colours);
+	hash = HashPalette(colours);
+	palSlot = FindNPCPaletteWithSameColours(colours, hash);
+	if (palSlot != 0xFF)
+	{
+		++sPalRefCache->stats.sharedHits;
 		return PalRefIncreaseCount(palSlot);
+	}
 
 	palSlot = AddPalRef(PalTypeNPC, palTag);
 	if (palSlot == 0xFF)
 		return PalRefIncreaseCount(0);
 
-	LoadNPCPalette(palTag, palSlot);
+	++sPalRefCache->stats.loads;
+	sPalRefCache->hash[palSlot] = hash;
+	LoadPalette(colours, 16 * 16 + palSlot * 16, 16 * sizeof(u16));
 	FogBrightenPalettes(FOG_BRIGHTEN_INTENSITY);
 	MaskPaletteIfFadingIn(palSlot);
 	return PalRefIncreaseCount(palSlot);
@@ -326,12 +497,16 @@ u8 FindOrCreateReflectionPalette(u8 palSlotNPC)
 	u16 palTag = sPalRefs[palSlotNPC].PalTag;
 	u8 palSlot = FindPalRef(PalTypeReflection, palTag);
 	if (palSlot != 0xFF)
+	{
+		++sPalRefCache->stats.residentHits;
 		return PalRefIncreaseCount(palSlot);
+	}
 
 	palSlot = AddPalRef(PalTypeReflection, palTag);
 	if (palSlot == 0xFF)
 		return PalRefIncreaseCount(0);
 
+	++sPalRefCache->stats.loads;
 	LoadNPCPalette(palTag, palSlot);
 	BlendPalettes(gBitTable[(palSlot + 16)], 6, RGB(12, 20, 27)); //Make it blueish
 	BrightenReflection(palSlot); //And a little brighter
@@ -6,6 +6,8 @@
 #include "../include/constants/songs.h"
 #include "../include/constants/trainer_classes.h"
 
+#include "../include/new/ability_battle_effects.h"
+#include "../include/new/battle_anims.h"
 #include "../include/new/battle_util.h"
 #include "../include/new/dynamax.h"
 #include "../include/new/end_battle.h"
@@ -656,6 +658,11 @@ static void EndBattleFlagClear(void)
 	Free(gNewBS->MegaData);
 	Free(gNewBS->UltraData);
 	Free(gNewBS->ZMoveData);
+	for (u32 i = 0; i < MAX_BATTLERS_COUNT; ++i)
+		FreeAbilityPopUpCacheTiles(i);
+	Free(gNewBS->abilityPopUpCache);
+	Free(gNewBS->indicatorState);
+	FreeAnimSheetCache();
 	Free(gNewBS);
 
 	//Handle DexNav Chain
@@ -1133,6 +1133,7 @@ u8 TurnBasedEffects(void)
 				gBattleStruct->turnEffectsBank = 0;
 				if (gNewBS->MagicRoomTimer > 0 && --gNewBS->MagicRoomTimer == 0)
 				{
+					InvalidateBattlerAttributeCaches();
 					BattleScriptExecute(BattleScript_MagicRoomEnd);
 					return ++effect;
 				}
@@ -1142,6 +1143,7 @@ u8 TurnBasedEffects(void)
 				gBattleStruct->turnEffectsBank = 0;
 				if (gNewBS->GravityTimer > 0 && --gNewBS->GravityTimer == 0)
 				{
+					InvalidateBattlerAttributeCaches();
 					BattleScriptExecute(BattleScript_GravityEnd);
 					return ++effect;
 				}
@@ -1218,6 +1220,7 @@ u8 TurnBasedEffects(void)
 							{
 								gLastUsedItem = ITEM(gActiveBattler);
 								RecordItemEffectBattle(gActiveBattler, itemEffect);
+								RecordItemWorkedBattle(gActiveBattler);
 								gBattleMons[gActiveBattler].status1 |= STATUS1_TOXIC_POISON;
 								EmitSetMonData(0, REQUEST_STATUS_BATTLE, 0, 4, &gBattleMons[gActiveBattler].status1);
 								MarkBufferBankForExecution(gActiveBattler);
@@ -1231,6 +1234,7 @@ u8 TurnBasedEffects(void)
 							{
 								gLastUsedItem = ITEM(gActiveBattler);
 								RecordItemEffectBattle(gActiveBattler, itemEffect);
+								RecordItemWorkedBattle(gActiveBattler);
 								gBattleMons[gActiveBattler].status1 |= STATUS1_BURN;
 								EmitSetMonData(0, REQUEST_STATUS_BATTLE, 0, 4, &gBattleMons[gActiveBattler].status1);
 								MarkBufferBankForExecution(gActiveBattler);
@@ -1,5 +1,6 @@
 #include "defines.h"
 #include "defines_battle.h"
+#include "../include/decompress.h"
 #include "../include/event_data.h"
 #include "../include/field_weather.h"
 #include "../include/random.h"
@@ -30,6 +31,7 @@ tables to edit:
 
 extern u8* gMaleFrontierNamesTable[];
 extern u8* gFemaleFrontierNamesTable[];
+extern const u8* const gFrontierTrainerTextDictionary[];
 
 extern const u8 gText_SingleBattle[];
 extern const u8 gText_DoubleBattle[];
@@ -316,29 +318,29 @@ void CopyFrontierTrainerText(u8 whichText, u16 trainerId, u8 battlerNum)
 		case BATTLE_TOWER_TID:
 			switch (whichText) {
 				case FRONTIER_BEFORE_TEXT:
-					StringCopy(gStringVar4, (gTowerTrainers[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].preBattleText));
+					DecompressStringCopy(gStringVar4, gTowerTrainers[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].preBattleText, gFrontierTrainerTextDictionary);
 					break;
 
 				case FRONTIER_PLAYER_LOST_TEXT:
-					StringCopy(gStringVar4, (gTowerTrainers[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].playerLoseText));
+					DecompressStringCopy(gStringVar4, gTowerTrainers[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].playerLoseText, gFrontierTrainerTextDictionary);
 					break;
 
 				case FRONTIER_PLAYER_WON_TEXT:
-					StringCopy(gStringVar4, (gTowerTrainers[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].playerWinText));
+					DecompressStringCopy(gStringVar4, gTowerTrainers[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].playerWinText, gFrontierTrainerTextDictionary);
 			}
 			break;
 		case BATTLE_TOWER_SPECIAL_TID:
 			switch (whichText) {
 				case FRONTIER_BEFORE_TEXT:
-					StringCopy(gStringVar4, (gSpecialTowerTrainers[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].preBattleText));
+					DecompressStringCopy(gStringVar4, gSpecialTowerTrainers[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].preBattleText, gFrontierTrainerTextDictionary);
 					break;
 
 				case FRONTIER_PLAYER_LOST_TEXT:
-					StringCopy(gStringVar4, (gSpecialTowerTrainers[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].playerLoseText));
+					DecompressStringCopy(gStringVar4, gSpecialTowerTrainers[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].playerLoseText, gFrontierTrainerTextDictionary);
 					break;
 
 				case FRONTIER_PLAYER_WON_TEXT:
-					StringCopy(gStringVar4, (gSpecialTowerTrainers[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].playerWinText));
+					DecompressStringCopy(gStringVar4, gSpecialTowerTrainers[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].playerWinText, gFrontierTrainerTextDictionary);
 			}
 			break;
 		case FRONTIER_BRAIN_TID:
@@ -346,19 +348,19 @@ void CopyFrontierTrainerText(u8 whichText, u16 trainerId, u8 battlerNum)
 			switch (whichText) {
 				case FRONTIER_BEFORE_TEXT:
 					if (gFrontierBrains[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].preBattleText != NULL)
-						StringCopy(gStringVar4, gFrontierBrains[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].preBattleText);
+						DecompressStringCopy(gStringVar4, gFrontierBrains[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].preBattleText, gFrontierTrainerTextDictionary);
 					break;
 
 				case FRONTIER_PLAYER_LOST_TEXT:
 					if (gFrontierBrains[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].playerLoseText != NULL)
-						StringCopy(gStringVar4, (gFrontierBrains[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].playerLoseText));
+						DecompressStringCopy(gStringVar4, gFrontierBrains[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].playerLoseText, gFrontierTrainerTextDictionary);
 					else //Frontier Brain text can be loaded from the OW
 						StringCopy(gStringVar4, GetTrainerAWinText());
 					break;
 
 				case FRONTIER_PLAYER_WON_TEXT:
 					if (gFrontierBrains[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].playerWinText != NULL)
-						StringCopy(gStringVar4, (gFrontierBrains[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].playerWinText));
+						DecompressStringCopy(gStringVar4, gFrontierBrains[VarGet(VAR_FACILITY_TRAINER_ID + battlerNum)].playerWinText, gFrontierTrainerTextDictionary);
 					else //Frontier Brain text can be loaded from the OW
 						StringCopy(gStringVar4, GetTrainerALoseText());
 			}
@@ -713,7 +715,9 @@ void sp053_LoadFrontierIntroBattleMessage(void)
 		gender = gFrontierBrains[id].gender;
 	}
 
-	gLoadPointer = text;
+	//The message box expands placeholders from gLoadPointer into gStringVar4, so the text can't be decompressed into gStringVar4 itself
+	DecompressStringCopy(gDecompressionBuffer, text, gFrontierTrainerTextDictionary);
+	gLoadPointer = gDecompressionBuffer;
 
 	//Change text colour
 	if (gender == BATTLE_FACILITY_MALE)
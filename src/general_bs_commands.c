@@ -2269,12 +2269,14 @@ void atk93_tryKO(void)
 			else if (defEffect == ITEM_EFFECT_FOCUS_BAND && !mystery && umodsi(Random(), 100) < defQuality)
 			{
 				RecordItemEffectBattle(bankDef, defEffect);
+				RecordItemWorkedBattle(bankDef);
 				gSpecialStatuses[bankDef].focusBanded = 1;
 			}
 			//Focus Sash
 			else if (IsBankHoldingFocusSash(bankDef) && BATTLER_MAX_HP(bankDef))
 			{
 				RecordItemEffectBattle(bankDef, defEffect);
+				RecordItemWorkedBattle(bankDef);
 				gSpecialStatuses[bankDef].focusBanded = 1;
 				gNewBS->EnduranceHelper = ENDURE_FOCUS_SASH;
 			}
@@ -145,6 +145,47 @@ u8 TMIdFromItemId(u16 itemId)
 	#endif
 }
 
+struct TMItemIndex
+{
+	u32 built; //Set to TM_ITEM_INDEX_BUILT once the table has been filled in
+	u16 items[NUM_TMSHMS]; //items[tmId]
+};
+
+#define sTMItemIndex ((struct TMItemIndex*) 0x203F08C)
+#define TM_ITEM_INDEX_BUILT 0x544D4858 //"TMHX"
+
+//The item data is in ROM so the reverse lookup only has to be built once.
+//If more than one item has the same TM number, the lowest item id is used.
+static void BuildTMItemIndex(void)
+{
+	u32 i;
+
+	Memset(sTMItemIndex->items, 0, sizeof(sTMItemIndex->items)); //ITEM_NONE
+	for (i = ITEM_NONE + 1; i < ITEMS_COUNT; ++i)
+	{
+		if (IsTMHM(i))
+		{
+			u8 tmId = TMIdFromItemId(i);
+
+			if (tmId < NUM_TMSHMS && sTMItemIndex->items[tmId] == ITEM_NONE)
+				sTMItemIndex->items[tmId] = i;
+		}
+	}
+
+	sTMItemIndex->built = TM_ITEM_INDEX_BUILT;
+}
+
+u16 ItemIdFromTMId(u8 tmId)
+{
+	if (tmId >= NUM_TMSHMS)
+		return ITEM_NONE;
+
+	if (sTMItemIndex->built != TM_ITEM_INDEX_BUILT)
+		BuildTMItemIndex();
+
+	return sTMItemIndex->items[tmId];
+}
+
 u8 BerryIdFromItemId(u16 item)
 {
 	u8 secondaryId = ItemId_GetMystery2(item);
@@ -352,6 +352,7 @@ u8 ItemBattleEffects(u8 caseID, u8 bank, bool8 moveTurn, bool8 doPluck)
 					BattleScriptExecute(BattleScript_ItemHealHP_End2);
 					effect = ITEM_HP_CHANGE;
 					RecordItemEffectBattle(bank, bankHoldEffect);
+					RecordItemWorkedBattle(bank);
 					gNewBS->leftoverHealingDone[bank] = TRUE;
 				}
 				break;
@@ -724,6 +725,7 @@ u8 ItemBattleEffects(u8 caseID, u8 bank, bool8 moveTurn, bool8 doPluck)
 					BattleScriptPushCursor();
 					gBattlescriptCurrInstr = BattleScript_RockyHelmetDamage;
 					RecordItemEffectBattle(bank, bankHoldEffect);
+					RecordItemWorkedBattle(bank);
 					gActiveBattler = gBankAttacker;
 					effect = ITEM_HP_CHANGE;
 				}
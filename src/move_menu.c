@@ -7,6 +7,7 @@
 
 #include "../include/new/accuracy_calc.h"
 #include "../include/new/ai_util.h"
+#include "../include/new/battle_anims.h"
 #include "../include/new/battle_indicators.h"
 #include "../include/new/battle_util.h"
 #include "../include/new/damage_calc.h"
@@ -218,6 +219,7 @@ void HandleInputChooseMove(void)
 	gNewBS->dynamaxData.partyIndex[SIDE(gActiveBattler)] = moveInfo->dynamaxPartyIndex;
 
 	sub_8033AC8();
+	PrefetchMoveAnimSheets(moveInfo->moves);
 
 	if (gMain.newKeys & A_BUTTON)
 	{
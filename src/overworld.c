@@ -34,6 +34,7 @@
 #include "../include/constants/trainers.h"
 #include "../include/constants/trainer_classes.h"
 
+#include "../include/new/battle_transition.h"
 #include "../include/new/item.h"
 #include "../include/new/follow_me.h"
 #include "../include/new/frontier.h"
@@ -646,6 +647,7 @@ u8 CheckForTrainersWantingBattle(void) {
 
 			TrainerWantsBattle(trainer->id, trainer->script);
 			TrainerApproachPlayer(&gEventObjects[trainer->id], trainer->distance - 1);
+			StartMugshotPreload();
 
 			if (trainer->script[1] == TRAINER_BATTLE_TWO_OPPONENTS)
 				ScriptContext1_SetupScript(EventScript_DoTwoOpponentBattle);
@@ -738,6 +740,7 @@ static void Task_OverworldMultiTrainers(u8 id)
 			for (int i = 0; i < 2; ++i, ++gApproachingTrainerId)
 				ConfigureTwoTrainersBattle(ExtensionState.spotted.trainers[i].id, ExtensionState.spotted.trainers[i].script);
 
+			StartMugshotPreload();
 			task->data[0]++;
 			break;
 
@@ -1584,10 +1587,12 @@ s32 DoPoisonFieldEffect(void)
 	for (i = 0; i < PARTY_SIZE; i++)
 	{
 		mon = &gPlayerParty[i];
+		if (!(mon->condition & STATUS1_PSN_ANY) //Plain field reads first so the ability is only worked out for poisoned mons
+		|| GetMonData(mon, MON_DATA_SPECIES, NULL) == SPECIES_NONE)
+			continue;
+
 		u8 ability = GetMonAbility(mon);
-		if (GetMonData(mon, MON_DATA_SPECIES, NULL) != SPECIES_NONE
-		&& GetMonPrimaryAilments(mon->condition) == AILMENT_PSN
-		&& ability != ABILITY_POISONHEAL && ability != ABILITY_MAGICGUARD)
+		if (ability != ABILITY_POISONHEAL && ability != ABILITY_MAGICGUARD)
 		{
 			hp = mon->hp;
 
@@ -1672,65 +1677,41 @@ bool8 UpdateRepelCounter(void)
 	return FALSE;
 }
 
+u8 GetCurrentAreaEnvironment(void)
+{
+	u8 mapSec = GetCurrentRegionMapSectionId();
+
+	if (mapSec >= ARRAY_COUNT(sMapSecEnvironments))
+		return 0;
+
+	return sMapSecEnvironments[mapSec];
+}
+
 bool8 IsCurrentAreaVolcano(void)
 {
-	#ifdef UNBOUND
-		return GetCurrentRegionMapSectionId() == MAPSEC_CINDER_VOLCANO;
-	#else
-		return FALSE;
-	#endif
+	return (GetCurrentAreaEnvironment() & MAPSEC_ENV_VOLCANO) != 0;
 }
 
 bool8 IsCurrentAreaAutumn(void)
 {
-	#ifdef UNBOUND
-		u8 mapSec = GetCurrentRegionMapSectionId();
-		return mapSec == MAPSEC_TEHL_TOWN
-			|| mapSec == MAPSEC_ROUTE_9
-			|| mapSec == MAPSEC_ROUTE_10
-			|| mapSec == MAPSEC_AUBURN_WATERWAY;
-	#else
-		return FALSE;
-	#endif
+	return (GetCurrentAreaEnvironment() & MAPSEC_ENV_AUTUMN) != 0;
 }
 
 bool8 IsCurrentAreaWinter(void)
 {
-	#ifdef UNBOUND
-		u8 mapSec = GetCurrentRegionMapSectionId();
-		return mapSec == MAPSEC_FROZEN_HEIGHTS
-			|| mapSec == MAPSEC_ROUTE_1
-			|| mapSec == MAPSEC_BELLIN_TOWN
-			|| mapSec == MAPSEC_ROUTE_8
-			|| mapSec == MAPSEC_BLIZZARD_CITY
-			|| mapSec == MAPSEC_FROZEN_FOREST;
-	#else
-		return FALSE;
-	#endif
+	return (GetCurrentAreaEnvironment() & MAPSEC_ENV_WINTER) != 0;
 }
 
 bool8 IsCurrentAreaDarkerCave(void)
 {
-	#ifdef UNBOUND
-		u8 mapSec = GetCurrentRegionMapSectionId();
-		return mapSec == MAPSEC_ICICLE_CAVE
-			|| mapSec == MAPSEC_VALLEY_CAVE
-			|| mapSec == MAPSEC_FROST_MOUNTAIN
-			|| mapSec == MAPSEC_THUNDERCAP_MOUNTAIN
-			|| mapSec == MAPSEC_DISTORTION_WORLD;
-	#else
-		return FALSE;
-	#endif
+	return (GetCurrentAreaEnvironment() & MAPSEC_ENV_DARKER_CAVE) != 0;
 }
 
 bool8 InTanobyRuins(void)
 {
 	#ifdef TANOBY_RUINS_ENABLED
 		if (FlagGet(FLAG_SYS_UNLOCKED_TANOBY_RUINS))
-		{
-			u8 mapSec = GetCurrentRegionMapSectionId();
-			return mapSec >= MAPSEC_MONEAN_CHAMBER && mapSec <= MAPSEC_VIAPOIS_CHAMBER;
-		}
+			return (GetCurrentAreaEnvironment() & MAPSEC_ENV_TANOBY_RUINS) != 0;
 	#endif
 
 	return FALSE;
@@ -290,105 +290,69 @@ static bool8 GetRaidBattleData(void)
 */	
 }
 
+#define OUTLINE_SPRITE_SIZE 64
+#define OUTLINE_SPRITE_TILE_ROW(tileX, y) ((((y) / 8) * (OUTLINE_SPRITE_SIZE / 8) + (tileX)) * 8 + ((y) % 8))
+
+//Packs a 4bpp tile row into one bit per pixel, set if the pixel isn't transparent
+static u32 TileRowToPixelMask(u32 row)
+{
+	row |= row >> 2;
+	row |= row >> 1;
+	row &= 0x11111111; //Lowest bit of each nibble is now set if any bit in it was
+	row = (row | (row >> 3)) & 0x03030303;
+	row = (row | (row >> 6)) & 0x000F000F;
+	return (row | (row >> 12)) & 0xFF;
+}
+
+//Spreads one bit per pixel back out to a 4bpp tile row, with colour 1 in each set pixel
+static u32 PixelMaskToTileRow(u32 mask)
+{
+	mask = (mask | (mask << 12)) & 0x000F000F;
+	mask = (mask | (mask << 6)) & 0x03030303;
+	return (mask | (mask << 3)) & 0x11111111;
+}
+
 static void OutlineMonSprite(u8 spriteId)
 {
-	u32 i = 0;
-	u8 buffer[(64 * 64) / 2] = {0};
-	u8* offset = (void*)(OBJ_VRAM0) + (gSprites[spriteId].oam.tileNum * 32);
-	u8* originalOffset = offset;
+	u32 x, y;
+	u64 filled[OUTLINE_SPRITE_SIZE]; //One bit per pixel, bit 0 is the left edge
+	u32* tiles = (u32*) ((void*)(OBJ_VRAM0) + (gSprites[spriteId].oam.tileNum * 32));
 
-	for (i = 0; i < (64 * 64) / 2; ++i)
+	for (y = 0; y < OUTLINE_SPRITE_SIZE; ++y)
 	{
-		/*Pixel Map - Bits
-		6	7
-
-		1	2	3
-		
-		4	5
-		*/
-
-		/*Pixel map - Bytes
-		67
-		12 3
-		45
-		*/
-
-		u8 nextByteColumn = 1;
-		if (i % 4 == 3)
-			nextByteColumn = 0x1D;
-
-		u8 nextByteRow = 4;
-		if (i % 0x20 >= 0x1C)
-			nextByteRow = 0xE4;
-			
-		u8 previousByteRow = 4;
-		if (i % 0x20 < 4)
-			previousByteRow = 0xE4;
-
-		//Next column
-		u8 pixel1 = offset[i] & 0xF;
-		u8 pixel2 = (offset[i] >> 4) & 0xF;
-
-		u8 pixel3 = offset[i + nextByteColumn] & 0xF;
-		
-		//Next row
-		u8 pixel4 = offset[i + nextByteRow] & 0xF;
-		u8 pixel5 = (offset[i + nextByteRow] >> 4) & 0xF;
-		
-		//Row Above
-		u8 pixel6 = offset[i - previousByteRow] & 0xF;
-		u8 pixel7 = (offset[i - previousByteRow] >> 4) & 0xF;
-
-		bool8 isTopBorder = (i < 0xE4) && ((i % 0x20) < 4);
-		bool8 isBottomBorder = (i >= 0x71C) && ((i % 0x20) >= 0x1C);
-		bool8 isLeftBorder = ((i % 0x100) < 0x20) && ((i % 4) == 0);
-		bool8 isRightBorder = ((i % 0x100) >= 0xE0) && ((i % 4) == 3);
-
-		if (pixel1 != 0)
-		{
-			if (isTopBorder || isBottomBorder || isLeftBorder)
-				buffer[i + 0] |= 0xF; //Set lower bit to white
-			else
-				buffer[i + 0] |= 0x1; //Set lower bit to black
-
-			if (pixel2 == 0)
-				buffer[i + 0] |= 0xF0; //Set upper bit
-
-			if (pixel4 == 0)
-				buffer[i + nextByteRow] |= 0xF; //Set lower bit
-				
-			if (i >= previousByteRow && pixel6 == 0)
-				buffer[i - previousByteRow] |= 0xF; //Set lower bit*/
-		}
+		u64 row = 0;
 
-		if (pixel2 != 0)
-		{
-			if (isTopBorder || isBottomBorder || isRightBorder) //Right border
-				buffer[i + 0] |= 0xF0; //Set upper bit to white
-			else
-				buffer[i + 0] |= 0x10; //Set upper bit to black
+		for (x = 0; x < OUTLINE_SPRITE_SIZE / 8; ++x)
+			row |= (u64) TileRowToPixelMask(tiles[OUTLINE_SPRITE_TILE_ROW(x, y)]) << (x * 8);
 
-			if (pixel1 == 0)
-				buffer[i + 0] |= 0xF; //Set lower bit
+		filled[y] = row;
+	}
 
-			if (pixel3 == 0 && (i % 0x100 < 0xE0 || i % 4 != 3))
-				buffer[i + nextByteColumn] |= 0xF; //Set lower bit
+	//Filled pixels become black, or white if they touch the edge of the sprite.
+	//Empty pixels next to a filled pixel (not diagonally) become the white outline.
+	for (y = 0; y < OUTLINE_SPRITE_SIZE; ++y)
+	{
+		u64 neighbours, border, white, black;
 
-			if (pixel5 == 0)
-				buffer[i + nextByteRow] |= 0xF0; //Set upper bit
+		neighbours = (filled[y] << 1) | (filled[y] >> 1);
+		if (y > 0)
+			neighbours |= filled[y - 1];
+		if (y < OUTLINE_SPRITE_SIZE - 1)
+			neighbours |= filled[y + 1];
 
-			if (i >= previousByteRow && pixel7 == 0)
-				buffer[i - previousByteRow] |= 0xF0; //Set upper bit
-		}
+		if (y == 0 || y == OUTLINE_SPRITE_SIZE - 1)
+			border = ~0ULL;
+		else
+			border = 1 | (1ULL << (OUTLINE_SPRITE_SIZE - 1));
 
-		if (pixel3 != 0 && !isRightBorder)
-		{
-			if (pixel2 == 0)
-				buffer[i + 0] |= 0xF0; //Set upper bit
-		}
+		white = (neighbours & ~filled[y]) | (filled[y] & border);
+		black = filled[y] & ~border;
+
+		for (x = 0; x < OUTLINE_SPRITE_SIZE / 8; ++x)
+			tiles[OUTLINE_SPRITE_TILE_ROW(x, y)] = PixelMaskToTileRow((white >> (x * 8)) & 0xFF) * 0xF
+												 | PixelMaskToTileRow((black >> (x * 8)) & 0xFF);
 	}
 
-	CpuCopy32(buffer, originalOffset, (64 * 64) / 2);
 	++sRaidBattleIntroPtr->outlinedSprite;
 }
 
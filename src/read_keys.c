@@ -1,5 +1,6 @@
 #include "defines.h"
 #include "../include/link.h"
+#include "../include/random.h"
 #include "../include/script.h"
 #include "../include/field_weather.h"
 
@@ -33,6 +34,13 @@ void InitKeys(void)
 extern const u8 SystemScript_EnableAutoRun[];
 extern const u8 SystemScript_DisableAutoRun[];
 
+#ifdef INPUT_RECORDING
+static void UpdateInputRecordingFrameStats(void);
+static void RecordKeys(u16 currKeys);
+static u16 ReplayKeys(u16 currKeys);
+static u16 TryRecordOrReplayKeys(u16 currKeys);
+#endif
+
 #ifdef SAVE_BLOCK_EXPANSION
 static void TryForcedScript(u8 keyFlag, u16 currKeys);
 static u16 TryForcedKey(u8 keyFlag, u16 currKeys);
@@ -80,11 +88,127 @@ static u16 TryIgnoringKeys(u8 keyFlag, u16 currKeys)
 #endif
 
 
+#ifdef INPUT_RECORDING
+static void ResetInputRecorder(u8 mode)
+{
+	gInputRecorder->mode = mode;
+	gInputRecorder->frames = 0;
+	gInputRecorder->lagFrames = 0;
+	gInputRecorder->lastVBlank = gMain.vblankCounter2;
+	gInputRecorder->replayIndex = 0;
+	gInputRecorder->replayFrame = 0;
+}
+
+void StartInputRecording(void)
+{
+	if (gInputRecorder->log == NULL)
+		gInputRecorder->log = Malloc(sizeof(struct InputRecordingEntry) * MAX_INPUT_RECORDING_ENTRIES);
+
+	if (gInputRecorder->log == NULL)
+		return; //Not enough memory
+
+	gInputRecorder->numEntries = 0;
+	gInputRecorder->overflowed = FALSE;
+	gInputRecorder->seed = gRngValue;
+	ResetInputRecorder(INPUT_RECORDING_RECORD);
+}
+
+//Replays the last recording from the point it was started. The game state
+//must match the one the recording was made from (eg. the same save file).
+void StartInputReplay(void)
+{
+	if (gInputRecorder->log == NULL || gInputRecorder->numEntries == 0)
+		return; //Nothing to replay
+
+	gRngValue = gInputRecorder->seed;
+	ResetInputRecorder(INPUT_RECORDING_REPLAY);
+}
+
+//The log is kept so it can be replayed or read out afterwards
+void StopInputRecording(void)
+{
+	gInputRecorder->mode = INPUT_RECORDING_OFF;
+}
+
+static void UpdateInputRecordingFrameStats(void)
+{
+	u32 vBlank = gMain.vblankCounter2;
+
+	if (vBlank - gInputRecorder->lastVBlank > 1)
+		gInputRecorder->lagFrames += vBlank - gInputRecorder->lastVBlank - 1;
+
+	gInputRecorder->lastVBlank = vBlank;
+	++gInputRecorder->frames;
+}
+
+static void RecordKeys(u16 currKeys)
+{
+	u32 numEntries = gInputRecorder->numEntries;
+
+	if (numEntries > 0
+	&& gInputRecorder->log[numEntries - 1].keys == currKeys
+	&& gInputRecorder->log[numEntries - 1].numFrames < 0xFFFF)
+		++gInputRecorder->log[numEntries - 1].numFrames;
+	else if (numEntries < MAX_INPUT_RECORDING_ENTRIES)
+	{
+		gInputRecorder->log[numEntries].keys = currKeys;
+		gInputRecorder->log[numEntries].numFrames = 1;
+		++gInputRecorder->numEntries;
+	}
+	else
+	{
+		gInputRecorder->overflowed = TRUE;
+		StopInputRecording();
+	}
+}
+
+static u16 ReplayKeys(u16 currKeys)
+{
+	struct InputRecordingEntry* entry;
+
+	if (gInputRecorder->replayIndex >= gInputRecorder->numEntries)
+	{
+		StopInputRecording(); //Give control back to the player
+		return currKeys;
+	}
+
+	entry = &gInputRecorder->log[gInputRecorder->replayIndex];
+
+	currKeys = entry->keys;
+	if (++gInputRecorder->replayFrame >= entry->numFrames)
+	{
+		gInputRecorder->replayFrame = 0;
+		++gInputRecorder->replayIndex;
+	}
+
+	return currKeys;
+}
+
+static u16 TryRecordOrReplayKeys(u16 currKeys)
+{
+	switch (gInputRecorder->mode) {
+		case INPUT_RECORDING_RECORD:
+			UpdateInputRecordingFrameStats();
+			RecordKeys(currKeys);
+			break;
+		case INPUT_RECORDING_REPLAY:
+			UpdateInputRecordingFrameStats();
+			currKeys = ReplayKeys(currKeys);
+			break;
+	}
+
+	return currKeys;
+}
+#endif
+
 // hook at 080005e8 via r0
 void ReadKeys(void)
 {
 	#ifdef SAVE_BLOCK_EXPANSION
 		u16 currKeys = gKeyReg;
+		#ifdef INPUT_RECORDING
+		currKeys = TryRecordOrReplayKeys(currKeys);
+		#endif
 		u8 tryKey = gKeypadSetter->keyFlags;
 		if (tryKey != 0)
 		{
@@ -93,6 +217,8 @@ void ReadKeys(void)
 			currKeys = TryIgnoringKeys(tryKey, currKeys);
 		}
 		u16 keyInput = KEYS_MASK ^ currKeys;
+	#elif (defined INPUT_RECORDING)
+		u16 keyInput = TryRecordOrReplayKeys(REG_KEYINPUT) ^ KEYS_MASK;
 	#else
 		u16 keyInput = REG_KEYINPUT ^ KEYS_MASK;
 	#endif
@@ -11,6 +11,7 @@ save.c
 // Each 4 KiB flash sector contains 3968 bytes of actual data followed by a 128 byte footer
 #define SECTOR_DATA_SIZE 0xFF0
 #define SECTOR_FOOTER_SIZE 128
+#define HOF_SECTOR_DATA_SIZE 0xF80
 #define SECTOR_SAVE_SLOT_LENGTH 14
 #define PLAYER_NAME_LENGTH 8
 #define FILE_SIGNATURE 0x08012025
@@ -56,6 +57,7 @@ static void SaveSector30And31();
 static void SaveParasite();
 static void LoadParasite();
 static void CallSomething(u16 arg, EraseFlash func);
+static u8 HandleWriteHallOfFameSector(u8 sector, u8* data);
 
 /* Saving and loading for sector 30 and 31. Could potentially add the Hall of fame sectors too */
 static void LoadSector30And31()
@@ -219,6 +221,30 @@ static void CallSomething(u16 arg, EraseFlash func)
 	func(arg);
 }
 
+/* New Hall of Fame teams are stored in place (see Task_Hof_InitTeamSaveData), so usually
+   only one of the two sectors changes. Skip erasing and rewriting a sector flash already has. */
+static u8 HandleWriteHallOfFameSector(u8 sector, u8* data)
+{
+	u32 i;
+	u32* newData = (u32*) data;
+	u32* oldData = (u32*) gFastSaveSection->data;
+
+	DoReadFlashWholeSection(sector, gFastSaveSection);
+	if (gFastSaveSection->security == FILE_SIGNATURE)
+	{
+		for (i = 0; i < HOF_SECTOR_DATA_SIZE / sizeof(u32); ++i)
+		{
+			if (oldData[i] != newData[i])
+				break;
+		}
+
+		if (i >= HOF_SECTOR_DATA_SIZE / sizeof(u32))
+			return SAVE_STATUS_OK;
+	}
+
+	return HandleWriteSectorNBytes(sector, data, HOF_SECTOR_DATA_SIZE);
+}
+
 
 u8 HandleSavingData(u8 saveType)
 {
@@ -248,8 +274,8 @@ u8 HandleSavingData(u8 saveType)
 				IncrementGameStat(GAME_STAT_ENTERED_HOF);
 			SaveSerializedGame();
 			SaveWriteToFlash(0xFFFF, gRamSaveSectionLocations);
-			HandleWriteSectorNBytes(SECTOR_ID_HOF_1, gDecompressionBuffer, 0xF80);
-			HandleWriteSectorNBytes(SECTOR_ID_HOF_2, gDecompressionBuffer + 0xF80, 0xF80);
+			HandleWriteHallOfFameSector(SECTOR_ID_HOF_1, gDecompressionBuffer);
+			HandleWriteHallOfFameSector(SECTOR_ID_HOF_2, gDecompressionBuffer + HOF_SECTOR_DATA_SIZE);
 			break;
 
 		case SAVE_OVERWRITE_DIFFERENT_FILE:
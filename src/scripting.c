@@ -933,6 +933,24 @@ void sp0CB_PlaceKeyScript(void)
 #endif
 }
 
+// Inputs:
+//		var8004: 0 = stop, 1 = start recording key presses, 2 = replay the last recording
+void sp0CD_SetInputRecordingMode(void)
+{
+#ifdef INPUT_RECORDING
+	switch (Var8004) {
+		case INPUT_RECORDING_RECORD:
+			StartInputRecording();
+			break;
+		case INPUT_RECORDING_REPLAY:
+			StartInputReplay();
+			break;
+		default:
+			StopInputRecording();
+	}
+#endif
+}
+
 //Variable Math Specials//
 ///////////////////////////////////////////////////////////////////////////////////
 
@@ -1938,13 +1956,8 @@ u8 sp0D0_PokemonInPartyThatCanLearnTMHM(void)
 {
 	u32 i;
 	u16 tm = Var8000;
-	for (i = 0; i < ITEMS_COUNT; ++i)
-	{
-		if (TMIdFromItemId(i) == tm)
-			break;
-	}
 
-	if (i == ITEMS_COUNT)
+	if (tm == 0 || tm > NUM_TMSHMS || ItemIdFromTMId(tm - 1) == ITEM_NONE)
 		return PARTY_SIZE; //Doesn't have the TM so can't use it without knowing it
 
 	for (i = 0; i < PARTY_SIZE; ++i)
@@ -1969,6 +1982,7 @@ void Task_HofPC_DrawSpritesPrintText(u8 taskId);
 void Task_HofPC_PrintMonInfo(u8 taskId);
 void Task_Hof_InitMonData(u8 taskId);
 void HallOfFame_PrintMonInfo(struct HallofFameMon *currMon, unusedArg u8 a1, unusedArg u8 a2);
+static u16 GetNewestHallOfFameTeam(const struct HallofFameTeam* teams);
 
 
 void CB2_DoHallOfFameScreen(void) {
@@ -1980,11 +1994,31 @@ void CB2_DoHallOfFameScreen(void) {
 }
 
 
+//The saved teams form a ring: once all slots are used, the newest team replaces
+//the oldest in place. Only the slot it lands in changes, so the save only has to
+//rewrite the flash sector holding that slot (see HandleSavingData).
+static u16 GetNewestHallOfFameTeam(const struct HallofFameTeam* teams)
+{
+	u16 i, newest = HALL_OF_FAME_MAX_TEAMS;
+
+	for (i = 0; i < HALL_OF_FAME_MAX_TEAMS; ++i)
+	{
+		if (teams[i].mon[0].species == SPECIES_NONE)
+			break; //The ring fills from the start, so nothing comes after an empty slot
+
+		//Saves from before the ring have every id at 0, so ties go to the later slot
+		if (newest >= HALL_OF_FAME_MAX_TEAMS || teams[i].mon[0].teamId >= teams[newest].mon[0].teamId)
+			newest = i;
+	}
+
+	return newest;
+}
+
 void Task_Hof_InitTeamSaveData(u8 taskId) {
-	u16 i;
+	u16 slot, newest, teamId;
 
 	Var8005 = 50;	// 020370c2
-	struct HallofFameTeam *lastSavedTeam = (struct HallofFameTeam *)(gDecompressionBuffer);
+	struct HallofFameTeam *savedTeams = (struct HallofFameTeam *)(gDecompressionBuffer);
 
 	sub_8112450();
 
@@ -1996,22 +2030,20 @@ void Task_Hof_InitTeamSaveData(u8 taskId) {
 			Memset(gDecompressionBuffer, 0, 0x2000);
 	}
 
-	for (i = 0; i < HALL_OF_FAME_MAX_TEAMS; ++i, ++lastSavedTeam)
+	newest = GetNewestHallOfFameTeam(savedTeams);
+	if (newest >= HALL_OF_FAME_MAX_TEAMS)
 	{
-		if (lastSavedTeam->mon[0].species == SPECIES_NONE)
-			break;
+		slot = 0;
+		teamId = 0;
 	}
-
-	if (i >= HALL_OF_FAME_MAX_TEAMS) {
-		struct HallofFameTeam *afterTeam = (struct HallofFameTeam *)(gDecompressionBuffer);
-		struct HallofFameTeam *beforeTeam = (struct HallofFameTeam *)(gDecompressionBuffer);
-		afterTeam++;
-		for (i = 0; i < HALL_OF_FAME_MAX_TEAMS - 1; ++i, beforeTeam++, afterTeam++) {
-			*beforeTeam = *afterTeam;
-		}
-		lastSavedTeam--;
+	else
+	{
+		slot = (newest + 1) % HALL_OF_FAME_MAX_TEAMS; //Overwrites the oldest team when full
+		teamId = savedTeams[newest].mon[0].teamId + 1;
 	}
-	*lastSavedTeam = *sHofMonPtr;
+
+	savedTeams[slot] = *sHofMonPtr;
+	savedTeams[slot].mon[0].teamId = teamId;
 
 	NewMenuHelpers_DrawDialogueFrame(0, 0);
 	AddTextPrinterParameterized2(0, 1, gText_SavingDontTurnOffPower, 0, NULL, 2, 1, 3);
@@ -2099,21 +2131,24 @@ void Task_HofPC_CopySaveData(u8 taskId) {
 	}
 	else
 	{
-		u16 i;
-		struct HallofFameTeam *savedTeams;
+		struct HallofFameTeam *savedTeams = (struct HallofFameTeam *)(gDecompressionBuffer);
+		u16 newest = GetNewestHallOfFameTeam(savedTeams);
 
-		CpuCopy16(gDecompressionBuffer, sHofMonPtr, 0x2000);
-		savedTeams = sHofMonPtr;
-		for (i = 0; i < HALL_OF_FAME_MAX_TEAMS; ++i, ++savedTeams)
+		if (newest < HALL_OF_FAME_MAX_TEAMS - 1 && savedTeams[newest + 1].mon[0].species != SPECIES_NONE)
 		{
-			if (savedTeams->mon[0].species == SPECIES_NONE)
-				break;
-		}
+			//The ring has wrapped, so unroll it to keep the teams oldest first
+			u16 oldest = newest + 1;
+			u32 olderSize = sizeof(struct HallofFameTeam) * (HALL_OF_FAME_MAX_TEAMS - oldest);
 
-		if (i < HALL_OF_FAME_MAX_TEAMS)
-			gTasks[taskId].tCurrTeamNo = i - 1;
-		else
+			CpuCopy16(&savedTeams[oldest], sHofMonPtr, olderSize);
+			CpuCopy16(savedTeams, ((u8*) sHofMonPtr) + olderSize, sizeof(struct HallofFameTeam) * oldest);
 			gTasks[taskId].tCurrTeamNo = HALL_OF_FAME_MAX_TEAMS - 1;
+		}
+		else
+		{
+			CpuCopy16(gDecompressionBuffer, sHofMonPtr, 0x2000);
+			gTasks[taskId].tCurrTeamNo = (newest < HALL_OF_FAME_MAX_TEAMS) ? newest : -1;
+		}
 
 		gTasks[taskId].tCurrPageNo = GetGameStat(GAME_STAT_ENTERED_HOF);
 
@@ -3,6 +3,7 @@
 #include "../include/random.h"
 #include "../include/party_menu.h"
 
+#include "../include/new/ability_battle_effects.h"
 #include "../include/new/ability_battle_scripts.h"
 #include "../include/new/ai_master.h"
 #include "../include/new/battle_indicators.h"
@@ -55,6 +56,7 @@ static bool8 TryDoForceSwitchOut(void);
 static void sub_80571DC(u8 battlerId, u8 arg1);
 static bool8 PPIsMaxed(bank_t);
 static u8 GetStealthRockDivisor(void);
+static u32 CalcEntryHazardDamagePartyMon(struct Pokemon* mon, u8 side);
 
 void atkE2_switchoutabilities(void)
 {
@@ -956,6 +958,8 @@ void ClearSwitchBytes(u8 bank)
 	DestroyMegaIndicator(bank);
 	ClearBattlerAbilityHistory(bank);
 	ClearBattlerItemEffectHistory(bank);
+	FreeAbilityPopUpCacheTiles(bank);
+	gNewBS->nameCache[bank].mon = NULL;
 }
 
 void ClearSwitchBits(u8 bank)
@@ -1098,25 +1102,74 @@ static u8 GetStealthRockDivisor(void)
 	return divisor;
 }
 
+static u32 CalcEntryHazardDamagePartyMon(struct Pokemon* mon, u8 side)
+{
+	u32 dmg = 0;
+
+	if (gSideTimers[side].srAmount > 0)
+		dmg += CalcStealthRockDamagePartyMon(mon);
+
+	if (gSideTimers[side].steelsurge > 0)
+		dmg += CalcSteelsurgeDamagePartyMon(mon);
+
+	if (gSideTimers[side].spikesAmount > 0)
+		dmg += CalcSpikesDamagePartyMon(mon, side);
+
+	return dmg;
+}
+
+//Gets the damage the mon would take from the hazards on its side, ignoring
+//Magic Guard and Heavy-Duty Boots. The AI asks this about the same party many
+//times while scoring switches, so the damage for each party slot is kept until
+//the hazards or the mon's data changes.
+u32 GetEntryHazardDamagePartyMon(struct Pokemon* mon, u8 side)
+{
+	struct HazardDamageCache* cache = &gNewBS->hazardDamageCache[side];
+	struct Pokemon* party = (side == B_SIDE_PLAYER) ? gPlayerParty : gEnemyParty;
+	u32 slot = mon - party;
+	u32 hazardKey, monKey[3];
+
+	if (mon < party || slot >= PARTY_SIZE) //Not from the side's party
+		return CalcEntryHazardDamagePartyMon(mon, side);
+
+	hazardKey = gSideTimers[side].srAmount
+			  | (gSideTimers[side].steelsurge << 8)
+			  | (gSideTimers[side].spikesAmount << 16);
+
+	if (cache->hazardKey != hazardKey)
+	{
+		cache->hazardKey = hazardKey;
+		cache->validSlots = 0;
+	}
+
+	monKey[0] = mon->personality;
+	monKey[1] = mon->species | (mon->maxHP << 16);
+	monKey[2] = mon->moves[0] | (mon->moves[1] << 16); //For Camomons
+
+	if (!(cache->validSlots & gBitTable[slot])
+	|| cache->monKey[slot][0] != monKey[0]
+	|| cache->monKey[slot][1] != monKey[1]
+	|| cache->monKey[slot][2] != monKey[2])
+	{
+		cache->monKey[slot][0] = monKey[0];
+		cache->monKey[slot][1] = monKey[1];
+		cache->monKey[slot][2] = monKey[2];
+		cache->damage[slot] = MathMin(CalcEntryHazardDamagePartyMon(mon, side), 0xFFFF);
+		cache->validSlots |= gBitTable[slot];
+	}
+
+	return cache->damage[slot];
+}
+
 bool8 WillFaintFromEntryHazards(struct Pokemon* mon, u8 side)
 {
 	u16 hp = GetMonData(mon, MON_DATA_HP, NULL);
-	u32 dmg = 0;
 
 	if (gSideAffecting[side] & SIDE_STATUS_SPIKES
 	&& GetMonAbility(mon) != ABILITY_MAGICGUARD
 	&& ItemId_GetHoldEffect(GetMonData(mon, MON_DATA_HELD_ITEM, NULL)) != ITEM_EFFECT_HEAVY_DUTY_BOOTS)
 	{
-		if (gSideTimers[side].srAmount > 0)
-			dmg += CalcStealthRockDamagePartyMon(mon);
-
-		if (gSideTimers[side].steelsurge > 0)
-			dmg += CalcSteelsurgeDamagePartyMon(mon);
-
-		if (gSideTimers[side].spikesAmount > 0)
-			dmg += CalcSpikesDamagePartyMon(mon, side);
-
-		if (dmg >= hp)
+		if (GetEntryHazardDamagePartyMon(mon, side) >= hp)
 			return TRUE;
 	}
 
@@ -382,3 +382,82 @@ bool8 CanPartyMonBeFrozen(struct Pokemon* mon)
 
 	return TRUE;
 }
+
+//Strings built with COMPRESS in their .string file (see scripts/string.py)
+#define COMPRESSED_STRING_ESCAPE 0xF7
+#define COMPRESSED_STRING_HEADER 0xFE
+#define COMPRESSED_STRING_LITERAL 0xFF
+#define COMPRESSED_STRING_SHORT_TOKENS_1_START 0x37
+#define COMPRESSED_STRING_SHORT_TOKENS_1_END 0x50
+#define COMPRESSED_STRING_SHORT_TOKENS_2_START 0x87
+#define COMPRESSED_STRING_SHORT_TOKENS_2_END 0x9F
+#define NUM_COMPRESSED_STRING_SHORT_TOKENS ((COMPRESSED_STRING_SHORT_TOKENS_1_END - COMPRESSED_STRING_SHORT_TOKENS_1_START + 1) \
+										  + (COMPRESSED_STRING_SHORT_TOKENS_2_END - COMPRESSED_STRING_SHORT_TOKENS_2_START + 1))
+
+bool8 IsCompressedString(const u8* str)
+{
+	return str[0] == COMPRESSED_STRING_ESCAPE && str[1] == COMPRESSED_STRING_HEADER;
+}
+
+void InitCompressedStringReader(struct CompressedStringReader* reader, const u8* src, const u8* const* dictionary)
+{
+	if (IsCompressedString(src))
+		src += 2;
+
+	reader->src = src;
+	reader->entry = NULL;
+	reader->dictionary = dictionary;
+}
+
+u8 ReadCompressedStringChar(struct CompressedStringReader* reader)
+{
+	u8 c;
+
+	if (reader->entry != NULL)
+	{
+		c = *reader->entry++;
+		if (c != EOS)
+			return c;
+
+		reader->entry = NULL; //Done with this entry
+	}
+
+	c = *reader->src++;
+
+	if (c >= COMPRESSED_STRING_SHORT_TOKENS_1_START && c <= COMPRESSED_STRING_SHORT_TOKENS_1_END)
+		reader->entry = reader->dictionary[c - COMPRESSED_STRING_SHORT_TOKENS_1_START];
+	else if (c >= COMPRESSED_STRING_SHORT_TOKENS_2_START && c <= COMPRESSED_STRING_SHORT_TOKENS_2_END)
+		reader->entry = reader->dictionary[c - COMPRESSED_STRING_SHORT_TOKENS_2_START + (COMPRESSED_STRING_SHORT_TOKENS_1_END - COMPRESSED_STRING_SHORT_TOKENS_1_START + 1)];
+	else if (c == COMPRESSED_STRING_ESCAPE)
+	{
+		c = *reader->src++;
+		if (c == COMPRESSED_STRING_LITERAL)
+			return *reader->src++;
+
+		reader->entry = reader->dictionary[NUM_COMPRESSED_STRING_SHORT_TOKENS + c];
+	}
+	else
+	{
+		if (c == EOS)
+			--reader->src; //Keep returning EOS
+		return c;
+	}
+
+	return *reader->entry++; //Entries are never empty
+}
+
+u8* DecompressStringCopy(u8* dst, const u8* src, const u8* const* dictionary)
+{
+	u8 c;
+	struct CompressedStringReader reader;
+
+	if (!IsCompressedString(src))
+		return StringCopy(dst, src);
+
+	InitCompressedStringReader(&reader, src, dictionary);
+	while ((c = ReadCompressedStringChar(&reader)) != EOS)
+		*dst++ = c;
+
+	*dst = EOS;
+	return dst;
+}